@@ -1158,6 +1158,15 @@ nsContentSink::StartLayout(bool aIgnorePendingSheets)
   mLayoutStarted = true;
   mLastNotificationTime = PR_Now();
 
+  // Even in performance mode, return to the event loop soon once layout has
+  // started, so that the first paint doesn't wait for the rest of a long
+  // parse slice.
+  uint32_t interactiveEndTime =
+    PR_IntervalToMicroseconds(PR_IntervalNow()) + sInteractiveParseTime;
+  if (mCurrentParseEndTime > interactiveEndTime) {
+    mCurrentParseEndTime = interactiveEndTime;
+  }
+
   mDocument->SetMayStartLayout(true);
   nsCOMPtr<nsIPresShell> shell = mDocument->GetShell();
   // Make sure we don't call Initialize() for a shell that has
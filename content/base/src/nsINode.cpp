@@ -2556,12 +2556,31 @@ FindMatchingElements(nsINode* aRoot, nsCSSSelectorList* aSelectorList, T &aList,
     return;
   }
 
+  // Likewise, when the only selector's rightmost compound requires a class
+  // (the common querySelectorAll(".item") case), reject elements which lack
+  // that class before setting up the full selector match.  Class matching is
+  // case-insensitive in quirks mode, so leave that to the rule processor.
+  nsIAtom* requiredClass = nullptr;
+  if (doc->GetCompatibilityMode() != eCompatibility_NavQuirks &&
+      !aSelectorList->mNext &&
+      aSelectorList->mSelectors->mClassList) {
+    requiredClass = aSelectorList->mSelectors->mClassList->mAtom;
+  }
+
   Collector results;
   for (nsIContent* cur = aRoot->GetFirstChild();
        cur;
        cur = cur->GetNextNode(aRoot)) {
-    if (cur->IsElement() &&
-        nsCSSRuleProcessor::SelectorListMatches(cur->AsElement(),
+    if (!cur->IsElement()) {
+      continue;
+    }
+    if (requiredClass) {
+      const nsAttrValue* classes = cur->GetClasses();
+      if (!classes || !classes->Contains(requiredClass, eCaseMatters)) {
+        continue;
+      }
+    }
+    if (nsCSSRuleProcessor::SelectorListMatches(cur->AsElement(),
                                                 matchingContext,
                                                 aSelectorList)) {
       if (onlyFirstMatch) {
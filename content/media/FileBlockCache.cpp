@@ -169,6 +169,41 @@ nsresult FileBlockCache::WriteBlockToFile(int32_t aBlockIndex,
   return NS_OK;
 }
 
+nsresult FileBlockCache::WriteBlocksToFile(int32_t aFirstBlockIndex,
+                                           const nsTArray< nsRefPtr<BlockChange> >& aChanges)
+{
+  mFileMonitor.AssertCurrentThreadOwns();
+  MOZ_ASSERT(aChanges.Length() <= MAX_COALESCED_BLOCKS);
+
+  if (aChanges.Length() == 1) {
+    return WriteBlockToFile(aFirstBlockIndex, aChanges[0]->mData.get());
+  }
+
+  nsresult rv = Seek(BlockIndexToOffset(aFirstBlockIndex));
+  if (NS_FAILED(rv)) return rv;
+
+  if (!mWriteBuffer) {
+    mWriteBuffer = new uint8_t[MAX_COALESCED_BLOCKS * BLOCK_SIZE];
+  }
+  for (uint32_t i = 0; i < aChanges.Length(); ++i) {
+    memcpy(mWriteBuffer.get() + i * BLOCK_SIZE, aChanges[i]->mData.get(),
+           BLOCK_SIZE);
+  }
+
+  int32_t length = aChanges.Length() * BLOCK_SIZE;
+  int32_t amount = PR_Write(mFD, mWriteBuffer.get(), length);
+  if (amount < length) {
+    NS_WARNING("Failed to write media cache blocks!");
+    // We don't know where a short write left the file pointer, make sure the
+    // next access seeks.
+    mFDCurrentPos = -1;
+    return NS_ERROR_FAILURE;
+  }
+  mFDCurrentPos += length;
+
+  return NS_OK;
+}
+
 nsresult FileBlockCache::MoveBlockInFile(int32_t aSourceBlockIndex,
                                          int32_t aDestBlockIndex)
 {
@@ -214,12 +249,44 @@ nsresult FileBlockCache::Run()
     nsRefPtr<BlockChange> change = mBlockChanges[blockIndex];
     NS_ABORT_IF_FALSE(change,
       "Change index list should only contain entries for blocks with changes");
+    if (change->IsWrite()) {
+      // Media data mostly arrives in order, so writes to the following
+      // blocks are often queued right behind this one. Merge them into one
+      // larger sequential write, which is much cheaper than several small
+      // ones on slow flash storage.
+      nsAutoTArray<nsRefPtr<BlockChange>, MAX_COALESCED_BLOCKS> changes;
+      changes.AppendElement(change);
+      while (changes.Length() < MAX_COALESCED_BLOCKS &&
+             !mChangeIndexList.IsEmpty() &&
+             mChangeIndexList.PeekFront() ==
+               blockIndex + static_cast<int32_t>(changes.Length())) {
+        BlockChange* next = mBlockChanges[mChangeIndexList.PeekFront()];
+        if (!next->IsWrite()) {
+          break;
+        }
+        mChangeIndexList.PopFront();
+        changes.AppendElement(next);
+      }
+      {
+        MonitorAutoUnlock unlock(mDataMonitor);
+        MonitorAutoLock lock(mFileMonitor);
+        WriteBlocksToFile(blockIndex, changes);
+      }
+      for (uint32_t i = 0; i < changes.Length(); ++i) {
+        // If a new change has not been made to the block while we dropped
+        // mDataMonitor, clear reference to the old change. Otherwise, the old
+        // reference has been cleared already.
+        if (mBlockChanges[blockIndex + i] == changes[i]) {
+          mBlockChanges[blockIndex + i] = nullptr;
+        }
+      }
+      continue;
+    }
+
     {
       MonitorAutoUnlock unlock(mDataMonitor);
       MonitorAutoLock lock(mFileMonitor);
-      if (change->IsWrite()) {
-        WriteBlockToFile(blockIndex, change->mData.get());
-      } else if (change->IsMove()) {
+      if (change->IsMove()) {
         MoveBlockInFile(change->mSourceBlockIndex, blockIndex);
       }
     }
@@ -125,6 +125,10 @@ public:
 
   class Int32Queue : private nsDeque {
   public:
+    int32_t PeekFront() {
+      return ObjectAt(0);
+    }
+
     int32_t PopFront() {
       int32_t front = ObjectAt(0);
       nsDeque::PopFront();
@@ -175,6 +179,15 @@ private:
                         int32_t aBytesToRead,
                         int32_t& aBytesRead);
   nsresult WriteBlockToFile(int32_t aBlockIndex, const uint8_t* aBlockData);
+  // Writes the blocks of aChanges, which must all be writes, to consecutive
+  // blocks starting at aFirstBlockIndex, using a single write call.
+  nsresult WriteBlocksToFile(int32_t aFirstBlockIndex,
+                             const nsTArray< nsRefPtr<BlockChange> >& aChanges);
+  // Maximum number of consecutive blocks Run() merges into one file write.
+  static const uint32_t MAX_COALESCED_BLOCKS = 8;
+  // Staging buffer for coalesced writes, MAX_COALESCED_BLOCKS blocks long.
+  // Allocated on first use.
+  nsAutoArrayPtr<uint8_t> mWriteBuffer;
   // File descriptor we're writing to. This is created externally, but
   // shutdown by us.
   PRFileDesc* mFD;
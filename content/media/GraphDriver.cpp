@@ -5,6 +5,7 @@
 
 #include <MediaStreamGraphImpl.h>
 #include "CubebUtils.h"
+#include "mozilla/Telemetry.h"
 
 #ifdef XP_MACOSX
 #include <sys/sysctl.h>
@@ -87,6 +88,8 @@ void GraphDriver::SwitchAtNextIteration(GraphDriver* aNextDriver)
   // Sometimes we switch twice to a new driver per iteration, this is probably a
   // bug.
   MOZ_ASSERT(!mNextDriver || mNextDriver->AsAudioCallbackDriver());
+  Telemetry::Accumulate(Telemetry::MEDIA_GRAPH_SWITCH_TO_AUDIO_DRIVER,
+                        !!aNextDriver->AsAudioCallbackDriver());
   mNextDriver = aNextDriver;
 }
 
@@ -536,6 +539,10 @@ AudioCallbackDriver::AudioCallbackDriver(MediaStreamGraphImpl* aGraphImpl, dom::
   , mAudioChannel(aChannel)
   , mInCallback(false)
   , mPauseRequested(false)
+  , mCallbackCount(0)
+  , mLateCallbackCount(0)
+  , mUnderrunCount(0)
+  , mMaxCallbackLoad(0)
 {
   STREAM_LOG(PR_LOG_DEBUG, ("AudioCallbackDriver ctor for graph %p", aGraphImpl));
 }
@@ -664,6 +671,27 @@ AudioCallbackDriver::Stop()
   if (cubeb_stream_stop(mAudioStream) != CUBEB_OK) {
     NS_WARNING("Could not stop cubeb stream for MSG.");
   }
+  // The stream is stopped, so the audio thread won't touch the statistics
+  // anymore.
+  ReportCallbackStats();
+}
+
+void
+AudioCallbackDriver::ReportCallbackStats()
+{
+  if (!mCallbackCount) {
+    return;
+  }
+  Telemetry::Accumulate(Telemetry::MEDIA_GRAPH_AUDIO_CALLBACK_MAX_LOAD,
+                        mMaxCallbackLoad);
+  Telemetry::Accumulate(Telemetry::MEDIA_GRAPH_AUDIO_CALLBACK_LATE_PERCENT,
+                        mLateCallbackCount * 100 / mCallbackCount);
+  Telemetry::Accumulate(Telemetry::MEDIA_GRAPH_AUDIO_UNDERRUNS,
+                        mUnderrunCount);
+  mCallbackCount = 0;
+  mLateCallbackCount = 0;
+  mUnderrunCount = 0;
+  mMaxCallbackLoad = 0;
 }
 
 void
@@ -798,6 +826,7 @@ AudioCallbackDriver::DataCallback(AudioDataValue* aBuffer, long aFrames)
     mGraphImpl->SwapMessageQueues();
   }
 
+  TimeStamp callbackStart = TimeStamp::Now();
   uint32_t durationMS = aFrames * 1000 / mSampleRate;
 
   // For now, simply average the duration with the previous
@@ -849,6 +878,7 @@ AudioCallbackDriver::DataCallback(AudioDataValue* aBuffer, long aFrames)
     if (mStateComputedTime < mIterationEnd) {
       STREAM_LOG(PR_LOG_WARNING, ("Media graph global underrun detected"));
       mIterationEnd = mStateComputedTime;
+      mUnderrunCount++;
     }
 
     stillProcessing = mGraphImpl->OneIteration(mIterationStart,
@@ -862,6 +892,18 @@ AudioCallbackDriver::DataCallback(AudioDataValue* aBuffer, long aFrames)
 
   mBuffer.BufferFilled();
 
+  // Compare the time spent in this callback with the duration of audio it
+  // had to produce. Only plain counters are updated here, telemetry is sent
+  // when the driver stops or switches away.
+  double budgetMS = aFrames * 1000.0 / mSampleRate;
+  uint32_t load = static_cast<uint32_t>(
+    (TimeStamp::Now() - callbackStart).ToMilliseconds() * 100 / budgetMS);
+  mCallbackCount++;
+  if (load > 100) {
+    mLateCallbackCount++;
+  }
+  mMaxCallbackLoad = std::max(mMaxCallbackLoad, load);
+
   if (mNextDriver && stillProcessing) {
     {
       // If the audio stream has not been started by the previous driver or
@@ -872,6 +914,7 @@ AudioCallbackDriver::DataCallback(AudioDataValue* aBuffer, long aFrames)
       }
     }
     STREAM_LOG(PR_LOG_DEBUG, ("Switching to system driver."));
+    ReportCallbackStats();
     mNextDriver->SetGraphTime(this, mIterationStart, mIterationEnd,
                                mStateComputedTime, mNextStateComputedTime);
     mGraphImpl->SetCurrentDriver(mNextDriver);
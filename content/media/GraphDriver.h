@@ -408,6 +408,10 @@ private:
   void DeviceChangedCallback();
   /* Start the cubeb stream */
   void StartStream();
+  /* Send the callback timing statistics gathered since the last call to
+   * telemetry, and reset them. This is not called from the audio callback
+   * itself except when switching away from this driver. */
+  void ReportCallbackStats();
   friend class AsyncCubebTask;
   void Init();
   /* MediaStreamGraphs are always down/up mixed to stereo for now. */
@@ -464,6 +468,13 @@ private:
    * True if microphone is being used by this process. This is synchronized by
    * the graph's monitor. */
   bool mMicrophoneActive;
+  /* Callback timing statistics, only touched on the audio thread while the
+   * stream runs, and reported by ReportCallbackStats(). */
+  uint32_t mCallbackCount;
+  uint32_t mLateCallbackCount;
+  uint32_t mUnderrunCount;
+  /* Longest callback, as a percentage of the duration of its buffer. */
+  uint32_t mMaxCallbackLoad;
 };
 
 class AsyncCubebTask : public nsRunnable
@@ -1229,7 +1229,8 @@ MediaStreamGraphImpl::ProduceDataForStreamsBlockByBlock(uint32_t aStreamIndex,
     for (uint32_t i = aStreamIndex; i < mStreams.Length(); ++i) {
       ProcessedMediaStream* ps = mStreams[i]->AsProcessedStream();
       if (ps) {
-        ps->ProcessInput(t, next, (next == aTo) ? ProcessedMediaStream::ALLOW_FINISH : 0);
+        ProcessInputForStream(ps, t, next,
+                              (next == aTo) ? ProcessedMediaStream::ALLOW_FINISH : 0);
       }
     }
     t = next;
@@ -1237,6 +1238,47 @@ MediaStreamGraphImpl::ProduceDataForStreamsBlockByBlock(uint32_t aStreamIndex,
   NS_ASSERTION(t == aTo, "Something went wrong with rounding to block boundaries");
 }
 
+void
+MediaStreamGraphImpl::ProcessInputForStream(ProcessedMediaStream* aStream,
+                                            GraphTime aFrom, GraphTime aTo,
+                                            uint32_t aFlags)
+{
+#ifdef PR_LOGGING
+  if (PR_LOG_TEST(gMediaStreamGraphLog, PR_LOG_DEBUG)) {
+    TimeStamp start = TimeStamp::Now();
+    aStream->ProcessInput(aFrom, aTo, aFlags);
+    aStream->mProcessingTime += TimeStamp::Now() - start;
+    return;
+  }
+#endif
+  aStream->ProcessInput(aFrom, aTo, aFlags);
+}
+
+void
+MediaStreamGraphImpl::LogStreamProcessingTimes(GraphTime aTo)
+{
+#ifdef PR_LOGGING
+  if (!PR_LOG_TEST(gMediaStreamGraphLog, PR_LOG_DEBUG) ||
+      aTo - mLastProcessingTimeLog < GraphRate()) {
+    return;
+  }
+
+  STREAM_LOG(PR_LOG_DEBUG,
+             ("MediaStreamGraph %p processing times for %fs of graph time:",
+              this, MediaTimeToSeconds(aTo - mLastProcessingTimeLog)));
+  for (uint32_t i = 0; i < mStreams.Length(); ++i) {
+    MediaStream* stream = mStreams[i];
+    if (stream->AsProcessedStream()) {
+      STREAM_LOG(PR_LOG_DEBUG, ("  MediaStream %p%s: %fms", stream,
+                                stream->AsAudioNodeStream() ? " (AudioNode)" : "",
+                                stream->mProcessingTime.ToMilliseconds()));
+    }
+    stream->mProcessingTime = TimeDuration();
+  }
+  mLastProcessingTimeLog = aTo;
+#endif
+}
+
 bool
 MediaStreamGraphImpl::AllFinishedStreamsNotified()
 {
@@ -1331,7 +1373,7 @@ MediaStreamGraphImpl::Process(GraphTime aFrom, GraphTime aTo)
           ProduceDataForStreamsBlockByBlock(i, n->SampleRate(), aFrom, aTo);
           doneAllProducing = true;
         } else {
-          ps->ProcessInput(aFrom, aTo, ProcessedMediaStream::ALLOW_FINISH);
+          ProcessInputForStream(ps, aFrom, aTo, ProcessedMediaStream::ALLOW_FINISH);
           NS_WARN_IF_FALSE(stream->mBuffer.GetEnd() >=
                            GraphTimeToStreamTime(stream, aTo),
                            "Stream did not produce enough data");
@@ -1381,6 +1423,8 @@ MediaStreamGraphImpl::Process(GraphTime aFrom, GraphTime aTo)
     }
   }
 
+  LogStreamProcessingTimes(aTo);
+
   if (!allBlockedForever) {
     EnsureNextIteration();
   }
@@ -2717,6 +2761,7 @@ MediaStreamGraphImpl::MediaStreamGraphImpl(bool aRealtime,
   , mMonitor("MediaStreamGraphImpl")
   , mLifecycleState(LIFECYCLE_THREAD_NOT_STARTED)
   , mEndTime(GRAPH_TIME_MAX)
+  , mLastProcessingTimeLog(0)
   , mSampleRate(aSampleRate)
   , mForceShutDown(false)
   , mPostedRunInStableStateEvent(false)
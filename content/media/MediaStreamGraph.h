@@ -8,6 +8,7 @@
 
 #include "mozilla/Mutex.h"
 #include "mozilla/LinkedList.h"
+#include "mozilla/TimeStamp.h"
 #include "AudioStream.h"
 #include "nsTArray.h"
 #include "nsIRunnable.h"
@@ -651,6 +652,11 @@ protected:
    */
   bool mNotifiedHasCurrentData;
 
+  // Time spent in this stream's ProcessInput since the graph last logged
+  // processing times. Only maintained while the MediaStreamGraph log is at
+  // debug level.
+  TimeDuration mProcessingTime;
+
   // True if the stream is being consumed (i.e. has track data being played,
   // or is feeding into some stream that is being consumed).
   bool mIsConsumed;
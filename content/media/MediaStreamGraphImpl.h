@@ -301,6 +301,18 @@ public:
                                          TrackRate aSampleRate,
                                          GraphTime aFrom,
                                          GraphTime aTo);
+  /**
+   * Call aStream->ProcessInput, adding the time it takes to the stream's
+   * mProcessingTime when the MediaStreamGraph log is at debug level.
+   */
+  void ProcessInputForStream(ProcessedMediaStream* aStream,
+                             GraphTime aFrom, GraphTime aTo, uint32_t aFlags);
+  /**
+   * Log and reset each stream's mProcessingTime, at most once per second of
+   * graph time, so that it's possible to see which streams use up the
+   * iteration budget.
+   */
+  void LogStreamProcessingTimes(GraphTime aTo);
   /**
    * Returns true if aStream will underrun at aTime for its own playback.
    * aEndBlockingDecisions is when we plan to stop making blocking decisions.
@@ -593,6 +605,10 @@ public:
    * The graph should stop processing at or after this time.
    */
   GraphTime mEndTime;
+  /**
+   * The graph time at which LogStreamProcessingTimes last logged.
+   */
+  GraphTime mLastProcessingTimeLog;
 
   /**
    * Sample rate at which this graph runs. For real time graphs, this is
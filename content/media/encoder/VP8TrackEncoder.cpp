@@ -11,6 +11,7 @@
 #include "prsystem.h"
 #include "WebMWriter.h"
 #include "libyuv.h"
+#include "mozilla/Telemetry.h"
 
 namespace mozilla {
 
@@ -33,6 +34,8 @@ VP8TrackEncoder::VP8TrackEncoder()
   , mEncodedFrameDuration(0)
   , mEncodedTimestamp(0)
   , mRemainingTicks(0)
+  , mEncodedFrameCount(0)
+  , mSkippedFrameCount(0)
   , mVPXContext(new vpx_codec_ctx_t())
   , mVPXImageWrapper(new vpx_image_t())
 {
@@ -498,6 +501,7 @@ VP8TrackEncoder::GetEncodedTrack(EncodedFrameContainer& aData)
         }
         // Get the encoded data from VP8 encoder.
         GetEncodedPartitions(aData);
+        mEncodedFrameCount++;
       } else {
         // SKIP_FRAME
         // Extend the duration of the last encoded data in aData
@@ -507,6 +511,7 @@ VP8TrackEncoder::GetEncodedTrack(EncodedFrameContainer& aData)
         if (last) {
           last->SetDuration(last->GetDuration() + encodedDuration);
         }
+        mSkippedFrameCount++;
       }
       // Move forward the mEncodedTimestamp.
       mEncodedTimestamp += encodedDuration;
@@ -538,6 +543,11 @@ VP8TrackEncoder::GetEncodedTrack(EncodedFrameContainer& aData)
   if (mEndOfStream) {
     VP8LOG("mEndOfStream is true\n");
     mEncodingComplete = true;
+    uint32_t targetFrames = mEncodedFrameCount + mSkippedFrameCount;
+    if (targetFrames) {
+      Telemetry::Accumulate(Telemetry::MEDIA_RECORDER_VP8_SKIPPED_FRAMES_PERCENT,
+                            mSkippedFrameCount * 100 / targetFrames);
+    }
     if (vpx_codec_encode(mVPXContext, nullptr, mEncodedTimestamp,
                          mEncodedFrameDuration, 0, VPX_DL_REALTIME)) {
       return NS_ERROR_FAILURE;
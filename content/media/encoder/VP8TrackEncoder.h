@@ -67,6 +67,10 @@ private:
   TrackTicks mEncodedTimestamp;
   // Duration to the next encode frame.
   TrackTicks mRemainingTicks;
+  // Number of target frames encoded and skipped so far. Frames are skipped
+  // when encoding falls behind real time.
+  uint32_t mEncodedFrameCount;
+  uint32_t mSkippedFrameCount;
 
   // Muted frame, we only create it once.
   nsRefPtr<layers::Image> mMuteFrame;
@@ -103,8 +103,18 @@ FFmpegH264Decoder<LIBAV_VER>::DoDecodeFrame(mp4_demuxer::MP4Sample* aSample)
     b.mPlanes[2].mWidth = (mFrame->width + 1) >> 1;
     b.mPlanes[2].mOffset = b.mPlanes[2].mSkip = 0;
 
+    // When the frame was decoded into an image allocated by
+    // AllocateYUV420PVideoBuffer, hand that image over as is. Its buffer is
+    // already shareable with the compositor, so the planes don't need to be
+    // copied into a new image.
+    Image* image = nullptr;
+    if (mCodecContext->pix_fmt == PIX_FMT_YUV420P) {
+      image = static_cast<Image*>(mFrame->opaque);
+    }
+
     VideoData *v = VideoData::Create(info,
                                      mImageContainer,
+                                     image,
                                      aSample->byte_offset,
                                      mFrame->pkt_pts,
                                      aSample->duration,
@@ -362,12 +362,15 @@ SourceBuffer::PrepareAppend(ErrorResult& aRv)
   // TODO: Consider a global eviction threshold  rather than per TrackBuffer.
   bool evicted = mTrackBuffer->EvictData(mEvictionThreshold);
   if (evicted) {
+    // Computing the buffered ranges queries every decoder of the track
+    // buffer, so only do it once.
+    double bufferedStart = GetBufferedStart();
     MSE_DEBUG("SourceBuffer(%p)::AppendData Evict; current buffered start=%f",
-              this, GetBufferedStart());
+              this, bufferedStart);
 
     // We notify that we've evicted from the time range 0 through to
     // the current start point.
-    mMediaSource->NotifyEvicted(0.0, GetBufferedStart());
+    mMediaSource->NotifyEvicted(0.0, bufferedStart);
   }
 
   // TODO: Test buffer full flag.
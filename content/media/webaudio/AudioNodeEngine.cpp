@@ -9,6 +9,10 @@
 #include "mozilla/arm.h"
 #include "AudioNodeEngineNEON.h"
 #endif
+#ifdef USE_SSE2
+#include "mozilla/SSE.h"
+#include "AudioNodeEngineSSE2.h"
+#endif
 
 namespace mozilla {
 
@@ -72,6 +76,12 @@ void AudioBufferAddWithScale(const float* aInput,
     AudioBufferAddWithScale_NEON(aInput, aScale, aOutput, aSize);
     return;
   }
+#endif
+#ifdef USE_SSE2
+  if (mozilla::supports_sse2()) {
+    AudioBufferAddWithScale_SSE2(aInput, aScale, aOutput, aSize);
+    return;
+  }
 #endif
   if (aScale == 1.0f) {
     for (uint32_t i = 0; i < aSize; ++i) {
@@ -105,6 +115,12 @@ AudioBlockCopyChannelWithScale(const float* aInput,
       AudioBlockCopyChannelWithScale_NEON(aInput, aScale, aOutput);
       return;
     }
+#endif
+#ifdef USE_SSE2
+    if (mozilla::supports_sse2()) {
+      AudioBlockCopyChannelWithScale_SSE2(aInput, aScale, aOutput);
+      return;
+    }
 #endif
     for (uint32_t i = 0; i < WEBAUDIO_BLOCK_SIZE; ++i) {
       aOutput[i] = aInput[i]*aScale;
@@ -153,6 +169,12 @@ AudioBlockCopyChannelWithScale(const float aInput[WEBAUDIO_BLOCK_SIZE],
     AudioBlockCopyChannelWithScale_NEON(aInput, aScale, aOutput);
     return;
   }
+#endif
+#ifdef USE_SSE2
+  if (mozilla::supports_sse2()) {
+    AudioBlockCopyChannelWithScale_SSE2(aInput, aScale, aOutput);
+    return;
+  }
 #endif
   for (uint32_t i = 0; i < WEBAUDIO_BLOCK_SIZE; ++i) {
     aOutput[i] = aInput[i]*aScale[i];
@@ -179,6 +201,12 @@ AudioBufferInPlaceScale(float* aBlock,
     AudioBufferInPlaceScale_NEON(aBlock, aScale, aSize);
     return;
   }
+#endif
+#ifdef USE_SSE2
+  if (mozilla::supports_sse2()) {
+    AudioBufferInPlaceScale_SSE2(aBlock, aScale, aSize);
+    return;
+  }
 #endif
   for (uint32_t i = 0; i < aSize; ++i) {
     *aBlock++ *= aScale;
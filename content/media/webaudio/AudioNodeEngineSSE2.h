@@ -0,0 +1,33 @@
+/* -*- mode: c++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* this source code form is subject to the terms of the mozilla public
+ * license, v. 2.0. if a copy of the mpl was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef MOZILLA_AUDIONODEENGINESSE2_H_
+#define MOZILLA_AUDIONODEENGINESSE2_H_
+
+#include "AudioNodeEngine.h"
+
+namespace mozilla {
+void AudioBufferAddWithScale_SSE2(const float* aInput,
+                                  float aScale,
+                                  float* aOutput,
+                                  uint32_t aSize);
+
+void
+AudioBlockCopyChannelWithScale_SSE2(const float* aInput,
+                                    float aScale,
+                                    float* aOutput);
+
+void
+AudioBlockCopyChannelWithScale_SSE2(const float aInput[WEBAUDIO_BLOCK_SIZE],
+                                    const float aScale[WEBAUDIO_BLOCK_SIZE],
+                                    float aOutput[WEBAUDIO_BLOCK_SIZE]);
+
+void
+AudioBufferInPlaceScale_SSE2(float* aBlock,
+                             float aScale,
+                             uint32_t aSize);
+}
+
+#endif /* MOZILLA_AUDIONODEENGINESSE2_H_ */
@@ -390,6 +390,13 @@ CollectWindowReports(nsGlobalWindow *aWindow,
   aWindowTotalSizes->mArenaStats.mStyleContexts
     += windowSizes.mArenaStats.mStyleContexts;
 
+  REPORT_SIZE("/layout/pres-arena-free", windowSizes.mArenaStats.mFreeEntries,
+              "Memory in the PresShell's arena that belonged to objects "
+              "which have since been destroyed, and which is waiting to be "
+              "reused by new objects of the same type, within a window.");
+  aWindowTotalSizes->mArenaStats.mFreeEntries
+    += windowSizes.mArenaStats.mFreeEntries;
+
   REPORT_SIZE("/layout/style-sets", windowSizes.mLayoutStyleSetsSize,
               "Memory used by style sets within a window.");
   aWindowTotalSizes->mLayoutStyleSetsSize += windowSizes.mLayoutStyleSetsSize;
@@ -596,6 +603,10 @@ nsWindowMemoryReporter::CollectReports(nsIMemoryReporterCallback* aCb,
          windowTotalSizes.mArenaStats.mStyleContexts,
          "This is the sum of all windows' 'layout/style-contexts' numbers.");
 
+  REPORT("window-objects/layout/pres-arena-free",
+         windowTotalSizes.mArenaStats.mFreeEntries,
+         "This is the sum of all windows' 'layout/pres-arena-free' numbers.");
+
   REPORT("window-objects/layout/style-sets", windowTotalSizes.mLayoutStyleSetsSize,
          "This is the sum of all windows' 'layout/style-sets' numbers.");
 
@@ -830,6 +830,7 @@ CanvasRenderingContext2D::CanvasRenderingContext2D()
   , mIsEntireFrameInvalid(false)
   , mPredictManyRedrawCalls(false), mPathTransformWillUpdate(false)
   , mInvalidateCount(0)
+  , mLastParsedColor(0)
 {
   sNumLivingContexts++;
   SetIsDOMBinding();
@@ -867,6 +868,12 @@ bool
 CanvasRenderingContext2D::ParseColor(const nsAString& aString,
                                      nscolor* aColor)
 {
+  if (!mLastParsedColorString.IsEmpty() &&
+      mLastParsedColorString.Equals(aString)) {
+    *aColor = mLastParsedColor;
+    return true;
+  }
+
   nsIDocument* document = mCanvasElement
                           ? mCanvasElement->OwnerDoc()
                           : nullptr;
@@ -882,6 +889,8 @@ CanvasRenderingContext2D::ParseColor(const nsAString& aString,
   if (value.IsNumericColorUnit()) {
     // if we already have a color we can just use it directly
     *aColor = value.GetColorValue();
+    mLastParsedColorString = aString;
+    mLastParsedColor = *aColor;
   } else {
     // otherwise resolve it
     nsIPresShell* presShell = GetPresShell();
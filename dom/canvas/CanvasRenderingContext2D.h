@@ -819,6 +819,15 @@ protected:
   uint32_t mInvalidateCount;
   static const uint32_t kCanvasMaxInvalidateCount = 100;
 
+  /**
+    * The last color string that ParseColor parsed to a numeric color, and
+    * that color. Scripts tend to set the same fillStyle and strokeStyle over
+    * and over, and running the CSS parser every time is expensive. Colors
+    * that depend on style, like currentColor, are never cached.
+    */
+  nsString mLastParsedColorString;
+  nscolor mLastParsedColor;
+
   /**
     * State information for hit regions
     */
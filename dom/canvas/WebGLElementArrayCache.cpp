@@ -433,7 +433,11 @@ bool WebGLElementArrayCacheTree<T>::Update(size_t firstByte, size_t lastByte)
   return true;
 }
 
-WebGLElementArrayCache::WebGLElementArrayCache() {
+WebGLElementArrayCache::WebGLElementArrayCache()
+  : mHasPendingUpdate(false)
+  , mPendingFirstByte(0)
+  , mPendingLastByte(0)
+{
 }
 
 WebGLElementArrayCache::~WebGLElementArrayCache() {
@@ -447,7 +451,13 @@ bool WebGLElementArrayCache::BufferData(const void* ptr, size_t byteLength) {
     }
   }
   MOZ_ASSERT(mBytes.Length() == byteLength);
-  return BufferSubData(0, ptr, byteLength);
+
+  // Resizing the trees is fallible, so don't defer the update here; the
+  // caller needs to know about an allocation failure right away.
+  mHasPendingUpdate = false;
+  if (!BufferSubData(0, ptr, byteLength))
+    return false;
+  return FlushPendingUpdate();
 }
 
 bool WebGLElementArrayCache::BufferSubData(size_t pos, const void* ptr, size_t updateByteLength) {
@@ -458,7 +468,34 @@ bool WebGLElementArrayCache::BufferSubData(size_t pos, const void* ptr, size_t u
     memcpy(mBytes.Elements() + pos, ptr, updateByteLength);
   else
     memset(mBytes.Elements() + pos, 0, updateByteLength);
-  return UpdateTrees(pos, pos + updateByteLength - 1);
+
+  size_t lastByte = pos + updateByteLength - 1;
+  if (mHasPendingUpdate &&
+      (pos > mPendingLastByte + 1 || lastByte + 1 < mPendingFirstByte))
+  {
+    // Merging disjoint ranges could make us revalidate lots of bytes that
+    // didn't change, so apply the pending range first.
+    if (!FlushPendingUpdate())
+      return false;
+  }
+
+  if (mHasPendingUpdate) {
+    mPendingFirstByte = std::min(mPendingFirstByte, pos);
+    mPendingLastByte = std::max(mPendingLastByte, lastByte);
+  } else {
+    mHasPendingUpdate = true;
+    mPendingFirstByte = pos;
+    mPendingLastByte = lastByte;
+  }
+  return true;
+}
+
+bool WebGLElementArrayCache::FlushPendingUpdate()
+{
+  if (!mHasPendingUpdate)
+    return true;
+  mHasPendingUpdate = false;
+  return UpdateTrees(mPendingFirstByte, mPendingLastByte);
 }
 
 bool WebGLElementArrayCache::UpdateTrees(size_t firstByte, size_t lastByte)
@@ -496,6 +533,9 @@ WebGLElementArrayCache::Validate(uint32_t maxAllowed, size_t firstElement,
   if (!mBytes.Length() || !countElements)
     return true;
 
+  if (!FlushPendingUpdate())
+    return false;
+
   ScopedDeletePtr<WebGLElementArrayCacheTree<T>>& tree = TreeForType<T>::Value(this);
   if (!tree) {
     tree = new WebGLElementArrayCacheTree<T>(*this);
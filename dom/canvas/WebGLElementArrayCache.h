@@ -83,12 +83,21 @@ private:
 
   bool UpdateTrees(size_t firstByte, size_t lastByte);
 
+  // Applies the byte range recorded by BufferSubData to the trees. Partial
+  // updates are deferred until the next Validate call, so that streaming
+  // apps that rewrite an index buffer in several pieces per frame only pay
+  // for one tree update.
+  bool FlushPendingUpdate();
+
   template<typename T>
   friend struct WebGLElementArrayCacheTree;
   template<typename T>
   friend struct TreeForType;
 
   FallibleTArray<uint8_t> mBytes;
+  bool mHasPendingUpdate;
+  size_t mPendingFirstByte;
+  size_t mPendingLastByte;
   ScopedDeletePtr<WebGLElementArrayCacheTree<uint8_t>> mUint8Tree;
   ScopedDeletePtr<WebGLElementArrayCacheTree<uint16_t>> mUint16Tree;
   ScopedDeletePtr<WebGLElementArrayCacheTree<uint32_t>> mUint32Tree;
@@ -129,6 +129,17 @@ void CheckSanity()
   CheckValidate(true,  c, type, 5, 0, 8);
   CheckValidate(false, c, type, 4, 0, 8);
 
+  // several partial updates between validations: a disjoint one, then one
+  // adjacent to it
+  T value = 7;
+  c.BufferSubData(2*sizeof(T), &value, sizeof(T));
+  c.BufferSubData(40*sizeof(T), &value, sizeof(T));
+  c.BufferSubData(41*sizeof(T), &value, sizeof(T));
+  CheckValidate(true,  c, type, 7, 0, 8);
+  CheckValidate(false, c, type, 6, 0, 8);
+  CheckValidate(false, c, type, 6, 32, 16);
+  CheckValidate(true,  c, type, 0, 42, 16);
+
   // now test a somewhat larger size to ensure we exceed the size of a tree leaf
   for(size_t i = 0; i < numElems; i++)
     data[i] = numElems - i;
@@ -9,6 +9,8 @@
 #include "IDBTransaction.h"
 #include "mozilla/Monitor.h"
 #include "mozilla/Move.h"
+#include "mozilla/Telemetry.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/ipc/BackgroundParent.h"
 #include "nsComponentManagerUtils.h"
 #include "nsIEventTarget.h"
@@ -151,6 +153,7 @@ class TransactionThreadPool::TransactionQueue MOZ_FINAL
 
   nsAutoTArray<nsCOMPtr<nsIRunnable>, 10> mQueue;
   nsRefPtr<FinishCallback> mFinishCallback;
+  TimeStamp mCreationTime;
   bool mShouldFinish;
 
 public:
@@ -790,6 +793,7 @@ TransactionQueue::TransactionQueue(TransactionThreadPool* aThreadPool,
   mDatabaseId(aDatabaseId),
   mObjectStoreNames(aObjectStoreNames),
   mMode(aMode),
+  mCreationTime(TimeStamp::Now()),
   mShouldFinish(false)
 {
   MOZ_ASSERT(aThreadPool);
@@ -803,6 +807,11 @@ TransactionThreadPool::TransactionQueue::Unblock()
 
   // NB: Finish may be called before Unblock.
 
+  Telemetry::ID id = mMode == IDBTransaction::READ_ONLY ?
+    Telemetry::INDEXEDDB_READ_TRANSACTION_QUEUE_DELAY_MS :
+    Telemetry::INDEXEDDB_WRITE_TRANSACTION_QUEUE_DELAY_MS;
+  Telemetry::AccumulateTimeDelta(id, mCreationTime);
+
   MOZ_ALWAYS_TRUE(NS_SUCCEEDED(
     mOwningThreadPool->mThreadPool->Dispatch(this, NS_DISPATCH_NORMAL)));
 }
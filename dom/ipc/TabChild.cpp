@@ -2085,6 +2085,12 @@ TabChild::RecvRealMouseEvent(const WidgetMouseEvent& event)
   return true;
 }
 
+bool
+TabChild::RecvRealMouseMoveEvent(const WidgetMouseEvent& event)
+{
+  return RecvRealMouseEvent(event);
+}
+
 bool
 TabChild::RecvMouseWheelEvent(const WidgetWheelEvent& event)
 {
@@ -863,7 +863,9 @@ bool TabParent::SendRealMouseEvent(WidgetMouseEvent& event)
       !MapEventCoordinatesForChildProcess(&event)) {
     return false;
   }
-  return PBrowserParent::SendRealMouseEvent(event);
+  return (event.message == NS_MOUSE_MOVE) ?
+    PBrowserParent::SendRealMouseMoveEvent(event) :
+    PBrowserParent::SendRealMouseEvent(event);
 }
 
 CSSPoint TabParent::AdjustTapToChildWidget(const CSSPoint& aPoint)
@@ -37,6 +37,7 @@
 #include "mozilla/dom/ScriptSettings.h"
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Preferences.h"
+#include "mozilla/Telemetry.h"
 #include "mozilla/dom/Navigator.h"
 #include "nsContentUtils.h"
 #include "nsCycleCollector.h"
@@ -956,6 +957,7 @@ class WorkerThreadPrimaryRunnable MOZ_FINAL : public nsRunnable
   WorkerPrivate* mWorkerPrivate;
   nsRefPtr<RuntimeService::WorkerThread> mThread;
   JSRuntime* mParentRuntime;
+  TimeStamp mScheduledTime;
 
   class FinishedRunnable MOZ_FINAL : public nsRunnable
   {
@@ -981,7 +983,8 @@ public:
   WorkerThreadPrimaryRunnable(WorkerPrivate* aWorkerPrivate,
                               RuntimeService::WorkerThread* aThread,
                               JSRuntime* aParentRuntime)
-  : mWorkerPrivate(aWorkerPrivate), mThread(aThread), mParentRuntime(aParentRuntime)
+  : mWorkerPrivate(aWorkerPrivate), mThread(aThread), mParentRuntime(aParentRuntime),
+    mScheduledTime(TimeStamp::Now())
   {
     MOZ_ASSERT(aWorkerPrivate);
     MOZ_ASSERT(aThread);
@@ -1676,6 +1679,8 @@ RuntimeService::ScheduleWorker(JSContext* aCx, WorkerPrivate* aWorkerPrivate)
     }
   }
 
+  Telemetry::Accumulate(Telemetry::DOM_WORKER_THREAD_REUSED, !!thread);
+
   if (!thread) {
     thread = WorkerThread::Create();
     if (!thread) {
@@ -2870,6 +2875,9 @@ WorkerThreadPrimaryRunnable::Run()
       return NS_ERROR_FAILURE;
     }
 
+    Telemetry::AccumulateTimeDelta(Telemetry::DOM_WORKER_STARTUP_MS,
+                                   mScheduledTime);
+
     {
 #ifdef MOZ_ENABLE_PROFILER_SPS
       PseudoStack* stack = mozilla_get_pseudo_stack();
@@ -69,6 +69,19 @@ DrawTargetCaptureImpl::DrawFilter(FilterNode *aNode,
   AppendCommand(DrawFilterCommand)(aNode, aSourceRect, aDestPoint, aOptions);
 }
 
+void
+DrawTargetCaptureImpl::DrawSurfaceWithShadow(SourceSurface *aSurface,
+                                             const Point &aDest,
+                                             const Color &aColor,
+                                             const Point &aOffset,
+                                             Float aSigma,
+                                             CompositionOp aOperator)
+{
+  aSurface->GuaranteePersistance();
+  AppendCommand(DrawSurfaceWithShadowCommand)(aSurface, aDest, aColor, aOffset,
+                                              aSigma, aOperator);
+}
+
 void
 DrawTargetCaptureImpl::ClearRect(const Rect &aRect)
 {
@@ -303,7 +303,8 @@ GLContext::GLContext(const SurfaceCaps& caps,
     mMaxRenderbufferSize(0),
     mNeedsTextureSizeChecks(false),
     mWorkAroundDriverBugs(true),
-    mHeavyGLCallsSinceLastFlush(false)
+    mHeavyGLCallsSinceLastFlush(false),
+    mUploadedBytes(0)
 {
     mOwningThreadId = PlatformThread::CurrentId();
 }
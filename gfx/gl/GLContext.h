@@ -42,6 +42,7 @@
 #include "GLContextSymbols.h"
 #include "base/platform_thread.h"       // for PlatformThreadId
 #include "mozilla/GenericRefCounted.h"
+#include "mozilla/TimeStamp.h"
 #include "gfx2DGlue.h"
 
 class nsIntRegion;
@@ -3674,6 +3675,24 @@ protected:
 
 public:
     void FlushIfHeavyGLCallsSinceLastFlush();
+
+    // Texture data uploaded through UploadImageDataToTexture since the last
+    // call to TakeUploadStats, for per-frame reporting by the compositor.
+    void AddUploadStats(uint32_t aBytes, const TimeDuration& aTime) {
+        mUploadedBytes += aBytes;
+        mUploadTime += aTime;
+    }
+
+    void TakeUploadStats(uint32_t* aBytes, TimeDuration* aTime) {
+        *aBytes = mUploadedBytes;
+        *aTime = mUploadTime;
+        mUploadedBytes = 0;
+        mUploadTime = TimeDuration();
+    }
+
+protected:
+    uint32_t mUploadedBytes;
+    TimeDuration mUploadTime;
 };
 
 bool DoesStringMatch(const char* aString, const char *aWantedString);
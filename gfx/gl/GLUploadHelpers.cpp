@@ -472,6 +472,9 @@ UploadImageDataToTexture(GLContext* gl,
             NS_ASSERTION(false, "Unhandled image surface format!");
     }
 
+    TimeStamp uploadStart = TimeStamp::Now();
+    uint32_t uploadedBytes = 0;
+
     nsIntRegionRectIterator iter(paintRegion);
     const nsIntRect *iterRect;
 
@@ -516,8 +519,11 @@ UploadImageDataToTexture(GLContext* gl,
                              rectData);
         }
 
+        uploadedBytes += iterRect->width * iterRect->height * pixelSize;
     }
 
+    gl->AddUploadStats(uploadedBytes, TimeStamp::Now() - uploadStart);
+
     return surfaceFormat;
 }
 
@@ -17,6 +17,8 @@
 #include "mozilla/mozalloc.h"           // for operator new
 #include "mozilla/TouchEvents.h"
 #include "mozilla/Preferences.h"        // for Preferences
+#include "mozilla/Telemetry.h"          // for Telemetry
+#include "mozilla/TimeStamp.h"          // for TimeStamp
 #include "nsDebug.h"                    // for NS_WARNING
 #include "nsPoint.h"                    // for nsIntPoint
 #include "nsThreadUtils.h"              // for NS_IsMainThread
@@ -1039,6 +1041,7 @@ APZCTreeManager::GetTargetAPZC(const ScrollableLayerGuid& aGuid)
 already_AddRefed<AsyncPanZoomController>
 APZCTreeManager::GetTargetAPZC(const ScreenPoint& aPoint, bool* aOutInOverscrolledApzc)
 {
+  TimeStamp start = TimeStamp::Now();
   MonitorAutoLock lock(mTreeLock);
   nsRefPtr<AsyncPanZoomController> target;
   // The root may have siblings, so check those too
@@ -1056,6 +1059,8 @@ APZCTreeManager::GetTargetAPZC(const ScreenPoint& aPoint, bool* aOutInOverscroll
   if (aOutInOverscrolledApzc) {
     *aOutInOverscrolledApzc = inOverscrolledApzc;
   }
+  Telemetry::Accumulate(Telemetry::APZ_HIT_TEST_US,
+    static_cast<uint32_t>((TimeStamp::Now() - start).ToMicroseconds()));
   return target.forget();
 }
 
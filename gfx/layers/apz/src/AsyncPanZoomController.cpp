@@ -31,6 +31,7 @@
 #include "mozilla/Preferences.h"        // for Preferences
 #include "mozilla/ReentrantMonitor.h"   // for ReentrantMonitorAutoEnter, etc
 #include "mozilla/StaticPtr.h"          // for StaticAutoPtr
+#include "mozilla/Telemetry.h"          // for Telemetry
 #include "mozilla/TimeStamp.h"          // for TimeDuration, TimeStamp
 #include "mozilla/dom/AnimationPlayer.h" // for ComputedTimingFunction
 #include "mozilla/dom/Touch.h"          // for Touch
@@ -2120,7 +2121,15 @@ void AsyncPanZoomController::TrackTouch(const MultiTouchInput& aEvent) {
   if (prevTouchPoint != touchPoint) {
     OverscrollHandoffState handoffState(
         *CurrentTouchBlock()->GetOverscrollHandoffChain(), panDistance);
-    CallDispatchScroll(prevTouchPoint, touchPoint, handoffState);
+    // Only time moves that were consumed by scrolling; otherwise no
+    // composite is scheduled for them and the sample would be charged to
+    // some unrelated later composite.
+    if (CallDispatchScroll(prevTouchPoint, touchPoint, handoffState)) {
+      ReentrantMonitorAutoEnter lock(mMonitor);
+      if (mUnsampledTouchMoveTime.IsNull()) {
+        mUnsampledTouchMoveTime = aEvent.mTimeStamp;
+      }
+    }
   }
 }
 
@@ -2441,6 +2450,10 @@ bool AsyncPanZoomController::UpdateAnimation(const TimeStamp& aSampleTime,
   if (mAnimation) {
     bool continueAnimation = mAnimation->Sample(mFrameMetrics, sampleTimeDelta);
     *aOutDeferredTasks = mAnimation->TakeDeferredTasks();
+    if (gfxPrefs::APZAllowCheckerboarding()) {
+      Telemetry::Accumulate(Telemetry::APZ_ANIMATION_CHECKERBOARD_PERCENT,
+                            GetCheckerboardPercent());
+    }
     if (continueAnimation) {
       if (mPaintThrottler.TimeSinceLastRequest(aSampleTime) >
           mAnimation->mRepaintInterval) {
@@ -2581,6 +2594,12 @@ void AsyncPanZoomController::SampleContentTransformForFrame(ViewTransform* aOutT
 
   aScrollOffset = mFrameMetrics.GetScrollOffset() * mFrameMetrics.GetZoom();
   *aOutTransform = GetCurrentAsyncTransform();
+
+  if (!mUnsampledTouchMoveTime.IsNull()) {
+    Telemetry::AccumulateTimeDelta(Telemetry::APZ_TOUCH_MOVE_TO_COMPOSITE_MS,
+                                   mUnsampledTouchMoveTime);
+    mUnsampledTouchMoveTime = TimeStamp();
+  }
 }
 
 ViewTransform AsyncPanZoomController::GetCurrentAsyncTransform() const {
@@ -2662,6 +2681,22 @@ bool AsyncPanZoomController::IsCurrentlyCheckerboarding() const {
   return !painted.Contains(visible);
 }
 
+uint32_t AsyncPanZoomController::GetCheckerboardPercent() const {
+  ReentrantMonitorAutoEnter lock(mMonitor);
+
+  CSSPoint currentScrollOffset = mFrameMetrics.GetScrollOffset() + mTestAsyncScrollOffset;
+  CSSRect painted = mLastContentPaintMetrics.mDisplayPort + mLastContentPaintMetrics.GetScrollOffset();
+  painted.Inflate(CSSMargin::FromAppUnits(nsMargin(1, 1, 1, 1)));   // fuzz for rounding error
+  CSSRect visible = CSSRect(currentScrollOffset, mFrameMetrics.CalculateCompositedSizeInCssPixels());
+  float visibleArea = visible.width * visible.height;
+  if (visibleArea <= 0) {
+    return 0;
+  }
+  CSSRect covered = painted.Intersect(visible);
+  float coveredArea = covered.width * covered.height;
+  return uint32_t(clamped(100.0f * (1.0f - coveredArea / visibleArea), 0.0f, 100.0f));
+}
+
 void AsyncPanZoomController::NotifyLayersUpdated(const FrameMetrics& aLayerMetrics, bool aIsFirstPaint) {
   AssertOnCompositorThread();
 
@@ -247,6 +247,13 @@ public:
    */
   bool IsCurrentlyCheckerboarding() const;
 
+  /**
+   * Returns the percentage of the composition bounds that isn't covered by
+   * the last-painted content, using the same computation as
+   * IsCurrentlyCheckerboarding().
+   */
+  uint32_t GetCheckerboardPercent() const;
+
   /**
    * Recalculates the displayport. Ideally, this should paint an area bigger
    * than the composite-to dimensions so that when you scroll down, you don't
@@ -687,6 +694,10 @@ private:
   // frame.
   TimeStamp mLastSampleTime;
 
+  // The time stamp of the oldest touch move that scrolled us and hasn't yet
+  // been sampled by a composite, for input latency telemetry.
+  TimeStamp mUnsampledTouchMoveTime;
+
   // Stores the previous focus point if there is a pinch gesture happening. Used
   // to allow panning by moving multiple fingers (thus moving the focus point).
   ParentLayerPoint mLastZoomFocus;
@@ -9,11 +9,47 @@
 
 #include "gfxPrefs.h"
 
+#include "mozilla/Atomics.h"
+#include "mozilla/gfx/Tools.h"
 #include "nsComponentManagerUtils.h"
+#include "nsIMemoryReporter.h"
 
 namespace mozilla {
 namespace layers {
 
+class TextureClientPoolReporter MOZ_FINAL : public nsIMemoryReporter
+{
+  ~TextureClientPoolReporter() {}
+
+public:
+  NS_DECL_ISUPPORTS
+
+  NS_IMETHOD CollectReports(nsIHandleReportCallback* aHandleReport,
+                            nsISupports* aData, bool aAnonymize)
+  {
+    nsresult rv = MOZ_COLLECT_REPORT(
+      "gfx-texture-client-pools/unused", KIND_OTHER, UNITS_BYTES,
+      size_t(sUnusedBytes),
+      "Memory used by texture clients that are sitting unused in a "
+      "TextureClientPool, waiting to be reused or freed.");
+    NS_ENSURE_SUCCESS(rv, rv);
+
+    return MOZ_COLLECT_REPORT(
+      "gfx-texture-client-pools/outstanding", KIND_OTHER, UNITS_BYTES,
+      size_t(sOutstandingBytes),
+      "Memory used by texture clients that were handed out by a "
+      "TextureClientPool and haven't been returned to it yet.");
+  }
+
+  static Atomic<size_t> sUnusedBytes;
+  static Atomic<size_t> sOutstandingBytes;
+};
+
+NS_IMPL_ISUPPORTS(TextureClientPoolReporter, nsIMemoryReporter)
+
+Atomic<size_t> TextureClientPoolReporter::sUnusedBytes(0);
+Atomic<size_t> TextureClientPoolReporter::sOutstandingBytes(0);
+
 static void
 ShrinkCallback(nsITimer *aTimer, void *aClosure)
 {
@@ -30,13 +66,38 @@ TextureClientPool::TextureClientPool(gfx::SurfaceFormat aFormat, gfx::IntSize aS
   , mShrinkTimeoutMsec(aShrinkTimeoutMsec)
   , mOutstandingClients(0)
   , mSurfaceAllocator(aAllocator)
+  , mReportedUnusedBytes(0)
+  , mReportedOutstandingBytes(0)
 {
   mTimer = do_CreateInstance("@mozilla.org/timer;1");
+
+  static bool registeredReporter = false;
+  if (!registeredReporter) {
+    RegisterStrongMemoryReporter(new TextureClientPoolReporter());
+    registeredReporter = true;
+  }
 }
 
 TextureClientPool::~TextureClientPool()
 {
   mTimer->Cancel();
+  TextureClientPoolReporter::sUnusedBytes -= mReportedUnusedBytes;
+  TextureClientPoolReporter::sOutstandingBytes -= mReportedOutstandingBytes;
+}
+
+void
+TextureClientPool::UpdateReportedSize()
+{
+  size_t clientBytes = size_t(mSize.width) * mSize.height *
+                       gfx::BytesPerPixel(mFormat);
+  size_t unusedBytes = mTextureClients.size() * clientBytes;
+  size_t outstandingBytes = mOutstandingClients * clientBytes;
+
+  TextureClientPoolReporter::sUnusedBytes += unusedBytes - mReportedUnusedBytes;
+  TextureClientPoolReporter::sOutstandingBytes +=
+    outstandingBytes - mReportedOutstandingBytes;
+  mReportedUnusedBytes = unusedBytes;
+  mReportedOutstandingBytes = outstandingBytes;
 }
 
 TemporaryRef<TextureClient>
@@ -48,6 +109,7 @@ TextureClientPool::GetTextureClient()
     mOutstandingClients++;
     textureClient = mTextureClients.top();
     mTextureClients.pop();
+    UpdateReportedSize();
     return textureClient;
   }
 
@@ -67,6 +129,7 @@ TextureClientPool::GetTextureClient()
   }
 
   mOutstandingClients++;
+  UpdateReportedSize();
   return textureClient;
 }
 
@@ -128,6 +191,7 @@ TextureClientPool::ShrinkToMaximumSize()
     }
     totalClientsOutstanding--;
   }
+  UpdateReportedSize();
 }
 
 void
@@ -136,6 +200,7 @@ TextureClientPool::ShrinkToMinimumSize()
   while (mTextureClients.size() > sMinCacheSize) {
     mTextureClients.pop();
   }
+  UpdateReportedSize();
 }
 
 void
@@ -169,6 +234,7 @@ TextureClientPool::Clear()
     mOutstandingClients--;
     mTextureClientsDeferred.pop();
   }
+  UpdateReportedSize();
 }
 
 }
@@ -78,6 +78,7 @@ public:
   void ReportClientLost() {
     MOZ_ASSERT(mOutstandingClients > mTextureClientsDeferred.size());
     mOutstandingClients--;
+    UpdateReportedSize();
   }
 
   /**
@@ -89,6 +90,12 @@ public:
   gfx::SurfaceFormat GetFormat() { return mFormat; }
 
 private:
+  /**
+   * Update the totals reported by the texture client pool memory reporter
+   * after mTextureClients or mOutstandingClients has changed.
+   */
+  void UpdateReportedSize();
+
   // The minimum size of the pool (the number of tiles that will be kept after
   // shrinking).
   static const uint32_t sMinCacheSize = 0;
@@ -119,6 +126,10 @@ private:
   std::stack<RefPtr<TextureClient> > mTextureClientsDeferred;
   nsRefPtr<nsITimer> mTimer;
   RefPtr<ISurfaceAllocator> mSurfaceAllocator;
+
+  // What this pool currently contributes to the memory reporter's totals.
+  size_t mReportedUnusedBytes;
+  size_t mReportedOutstandingBytes;
 };
 
 }
@@ -111,6 +111,13 @@ CanvasLayerComposite::GetCompositableHost()
   return nullptr;
 }
 
+bool
+CanvasLayerComposite::HasContentToDraw()
+{
+  return mImageHost && mImageHost->IsAttached() &&
+         mImageHost->GetAsTextureHost();
+}
+
 void
 CanvasLayerComposite::CleanupResources()
 {
@@ -58,6 +58,8 @@ public:
 
   CompositableHost* GetCompositableHost() MOZ_OVERRIDE;
 
+  virtual bool HasContentToDraw() MOZ_OVERRIDE;
+
   virtual LayerComposite* AsLayerComposite() MOZ_OVERRIDE { return this; }
 
   void SetBounds(nsIntRect aBounds) { mBounds = aBounds; }
@@ -51,6 +51,8 @@ public:
 
   CompositableHost* GetCompositableHost() MOZ_OVERRIDE { return nullptr; }
 
+  virtual bool HasContentToDraw() MOZ_OVERRIDE { return true; }
+
   virtual LayerComposite* AsLayerComposite() MOZ_OVERRIDE { return this; }
 
   virtual const char* Name() const MOZ_OVERRIDE { return "ColorLayerComposite"; }
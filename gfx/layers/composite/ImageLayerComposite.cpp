@@ -153,6 +153,13 @@ ImageLayerComposite::GetCompositableHost()
   return nullptr;
 }
 
+bool
+ImageLayerComposite::HasContentToDraw()
+{
+  return mImageHost && mImageHost->IsAttached() &&
+         mImageHost->GetAsTextureHost();
+}
+
 void
 ImageLayerComposite::CleanupResources()
 {
@@ -53,6 +53,8 @@ public:
 
   CompositableHost* GetCompositableHost() MOZ_OVERRIDE;
 
+  virtual bool HasContentToDraw() MOZ_OVERRIDE;
+
   virtual void GenEffectChain(EffectChain& aEffect) MOZ_OVERRIDE;
 
   virtual LayerComposite* AsLayerComposite() MOZ_OVERRIDE { return this; }
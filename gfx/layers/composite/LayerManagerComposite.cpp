@@ -133,7 +133,9 @@ void
 LayerManagerComposite::Destroy()
 {
   if (!mDestroyed) {
-    mCompositor->GetWidget()->CleanupWindowEffects();
+    if (nsIWidget* widget = mCompositor->GetWidget()) {
+      widget->CleanupWindowEffects();
+    }
     if (mRoot) {
       RootLayer()->Destroy();
     }
@@ -257,8 +259,17 @@ LayerManagerComposite::EndTransaction(DrawPaintedLayerCallback aCallback,
     // so we don't need to pass any global transform here.
     mRoot->ComputeEffectiveTransforms(gfx::Matrix4x4());
 
+    // Culling depends on the async transforms of this composite, so undo it
+    // once we've rendered; the next composite may not have a new transaction
+    // to reset the visible regions.
+    nsIntRegion opaque;
+    nsTArray<CulledVisibleRegion> culled;
+    ApplyOcclusionCulling(mRoot, opaque, culled);
+
     Render();
     mGeometryChanged = false;
+
+    RestoreCulledVisibleRegions(culled);
   } else {
     // Modified layer tree
     mGeometryChanged = true;
@@ -553,6 +564,74 @@ LayerManagerComposite::PopGroupForLayerEffects(RefPtr<CompositingRenderTarget> a
                         Matrix4x4());
 }
 
+/* static */ void
+LayerManagerComposite::ApplyOcclusionCulling(Layer* aLayer,
+                                             nsIntRegion& aOpaqueRegion,
+                                             nsTArray<CulledVisibleRegion>& aCulled)
+{
+  // We can only bring aOpaqueRegion into aLayer's coordinate space, and
+  // aLayer's opaque area back out, if its transform is an integer
+  // translation.
+  nsIntRegion localOpaque;
+  gfx::Matrix transform2d;
+  bool isTranslation = aLayer->GetLocalTransform().Is2D(&transform2d) &&
+                       transform2d.IsIntegerTranslation();
+  int32_t dx = isTranslation ? int32_t(transform2d._31) : 0;
+  int32_t dy = isTranslation ? int32_t(transform2d._32) : 0;
+  if (isTranslation) {
+    localOpaque = aOpaqueRegion;
+    localOpaque.MoveBy(-dx, -dy);
+  }
+
+  LayerComposite* composite = aLayer->AsLayerComposite();
+  if (!localOpaque.IsEmpty()) {
+    const nsIntRegion& visible = composite->GetShadowVisibleRegion();
+    if (localOpaque.Intersects(visible.GetBounds())) {
+      CulledVisibleRegion* entry = aCulled.AppendElement();
+      entry->mLayer = composite;
+      entry->mVisibleRegion = visible;
+      nsIntRegion newVisible;
+      newVisible.Sub(visible, localOpaque);
+      composite->SetShadowVisibleRegion(newVisible);
+    }
+  }
+
+  // Children are drawn back-to-front, so walk them front-to-back, letting
+  // each one occlude the ones below it.
+  for (Layer* child = aLayer->GetLastChild(); child;
+       child = child->GetPrevSibling()) {
+    ApplyOcclusionCulling(child, localOpaque, aCulled);
+  }
+
+  if (!isTranslation || aLayer->GetMaskLayer() ||
+      aLayer->GetLocalOpacity() != 1.0f ||
+      aLayer->GetEffectiveMixBlendMode() != gfx::CompositionOp::OP_OVER) {
+    return;
+  }
+
+  // Tiled layers may not have painted all of their visible region yet, and
+  // layers without content draw nothing at all, so don't let them hide
+  // what's underneath.
+  if ((aLayer->GetContentFlags() & Layer::CONTENT_OPAQUE) &&
+      !composite->GetTiledLayerComposer() &&
+      composite->HasContentToDraw()) {
+    localOpaque.Or(localOpaque, composite->GetShadowVisibleRegion());
+  }
+  localOpaque.MoveBy(dx, dy);
+  if (const nsIntRect* clip = aLayer->GetEffectiveClipRect()) {
+    localOpaque.And(localOpaque, *clip);
+  }
+  aOpaqueRegion.Or(aOpaqueRegion, localOpaque);
+}
+
+/* static */ void
+LayerManagerComposite::RestoreCulledVisibleRegions(const nsTArray<CulledVisibleRegion>& aCulled)
+{
+  for (uint32_t i = 0; i < aCulled.Length(); i++) {
+    aCulled[i].mLayer->SetShadowVisibleRegion(aCulled[i].mVisibleRegion);
+  }
+}
+
 void
 LayerManagerComposite::Render()
 {
@@ -250,6 +250,28 @@ public:
 
   bool LastFrameMissedHWC() { return mLastFrameMissedHWC; }
 
+  struct CulledVisibleRegion {
+    LayerComposite* mLayer;
+    nsIntRegion mVisibleRegion;
+  };
+
+  /**
+   * Recursive helper that walks aLayer's subtree front-to-back and removes
+   * from each layer's shadow visible region anything covered by opaque
+   * layers drawn above it. aOpaqueRegion is in the coordinate space of
+   * aLayer's parent; on return, aLayer's own opaque area has been added to
+   * it. The original visible region of every layer that is culled is
+   * appended to aCulled so it can be restored after rendering.
+   */
+  static void ApplyOcclusionCulling(Layer* aLayer,
+                                    nsIntRegion& aOpaqueRegion,
+                                    nsTArray<CulledVisibleRegion>& aCulled);
+
+  /**
+   * Put back the visible regions that ApplyOcclusionCulling removed.
+   */
+  static void RestoreCulledVisibleRegions(const nsTArray<CulledVisibleRegion>& aCulled);
+
 private:
   /** Region we're clipping our current drawing to. */
   nsIntRegion mClippingRegion;
@@ -375,6 +397,14 @@ public:
 
   virtual TiledLayerComposer* GetTiledLayerComposer() { return nullptr; }
 
+  /**
+   * Returns true if this layer currently has content to draw over its whole
+   * shadow visible region. Layers without any (e.g. whose compositable
+   * hasn't received a front buffer yet) draw nothing, so they can't hide the
+   * layers underneath them even when they are CONTENT_OPAQUE.
+   */
+  virtual bool HasContentToDraw() { return false; }
+
   virtual void DestroyFrontBuffer() { }
 
   void AddBlendModeEffect(EffectChain& aEffectChain);
@@ -156,6 +156,14 @@ PaintedLayerComposite::GetCompositableHost()
   return nullptr;
 }
 
+bool
+PaintedLayerComposite::HasContentToDraw()
+{
+  // The buffer only holds content for the valid region.
+  return mBuffer && mBuffer->IsAttached() &&
+         mValidRegion.Contains(GetShadowVisibleRegion());
+}
+
 void
 PaintedLayerComposite::CleanupResources()
 {
@@ -49,6 +49,8 @@ public:
 
   CompositableHost* GetCompositableHost() MOZ_OVERRIDE;
 
+  virtual bool HasContentToDraw() MOZ_OVERRIDE;
+
   virtual void Destroy() MOZ_OVERRIDE;
 
   virtual Layer* GetLayer() MOZ_OVERRIDE;
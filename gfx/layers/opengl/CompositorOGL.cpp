@@ -21,6 +21,7 @@
 #include "gfxUtils.h"                   // for NextPowerOfTwo, gfxUtils, etc
 #include "mozilla/ArrayUtils.h"         // for ArrayLength
 #include "mozilla/Preferences.h"        // for Preferences
+#include "mozilla/Telemetry.h"          // for Accumulate
 #include "mozilla/gfx/BasePoint.h"      // for BasePoint
 #include "mozilla/gfx/Matrix.h"         // for Matrix4x4, Matrix
 #include "mozilla/layers/LayerManagerComposite.h"  // for LayerComposite, etc
@@ -1330,6 +1331,16 @@ CompositorOGL::EndFrame()
 
   MOZ_ASSERT(mCurrentRenderTarget == mWindowRenderTarget, "Rendering target not properly restored");
 
+  uint32_t uploadedBytes;
+  TimeDuration uploadTime;
+  mGLContext->TakeUploadStats(&uploadedBytes, &uploadTime);
+  if (uploadedBytes) {
+    Telemetry::Accumulate(Telemetry::COMPOSITE_TEXTURE_UPLOAD_KB,
+                          uploadedBytes / 1024);
+    Telemetry::Accumulate(Telemetry::COMPOSITE_TEXTURE_UPLOAD_TIME_MS,
+                          uint32_t(uploadTime.ToMilliseconds()));
+  }
+
 #ifdef MOZ_DUMP_PAINTING
   if (gfxUtils::sDumpPainting) {
     nsIntRect rect;
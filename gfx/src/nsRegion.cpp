@@ -23,10 +23,23 @@ bool nsRegion::Contains(const nsRegion& aRgn) const
 
 bool nsRegion::Intersects(const nsRect& aRect) const
 {
-  // XXX this could be made faster
-  nsRegionRectIterator iter(*this);
-  while (const nsRect* r = iter.Next()) {
-    if (r->Intersects(aRect)) {
+  // Most callers test rects that miss the region's bounds entirely.
+  if (!GetBounds().Intersects(aRect)) {
+    return false;
+  }
+
+  // pixman keeps the rects sorted into y-x bands, so we can skip the bands
+  // above aRect and stop at the first band below it.
+  int n;
+  pixman_box32_t *boxes = pixman_region32_rectangles(Impl(), &n);
+  for (int i = 0; i < n; i++) {
+    if (boxes[i].y2 <= aRect.y) {
+      continue;
+    }
+    if (boxes[i].y1 >= aRect.YMost()) {
+      break;
+    }
+    if (boxes[i].x1 < aRect.XMost() && aRect.x < boxes[i].x2) {
       return true;
     }
   }
@@ -0,0 +1,153 @@
+/* vim:set ts=2 sw=2 sts=2 et: */
+/* Any copyright is dedicated to the Public Domain.
+ * http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include "gtest/gtest.h"
+
+#include "mozilla/layers/BasicCompositor.h"
+#include "mozilla/layers/ColorLayerComposite.h"
+#include "mozilla/layers/ContainerLayerComposite.h"
+#include "mozilla/layers/ImageLayerComposite.h"
+#include "mozilla/layers/LayerManagerComposite.h"
+#include "mozilla/layers/PaintedLayerComposite.h"
+
+using namespace mozilla;
+using namespace mozilla::gfx;
+using namespace mozilla::layers;
+
+/*
+ * These tests build a root container with a bottom layer covering
+ * (0, 0, 100, 100) and a CONTENT_OPAQUE layer above it covering the top half,
+ * and check which configurations of the top layer let
+ * LayerManagerComposite::ApplyOcclusionCulling remove the covered half from
+ * the bottom layer's visible region.
+ */
+
+class LayerOcclusion : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    // There's no widget; we only build and cull the layer tree.
+    mManager = new LayerManagerComposite(new BasicCompositor(nullptr));
+    mRoot = mManager->CreateContainerLayerComposite();
+    mManager->SetRoot(mRoot);
+
+    mBottom = mManager->CreateColorLayerComposite();
+    mBottom->SetShadowVisibleRegion(nsIntRect(0, 0, 100, 100));
+    mRoot->InsertAfter(mBottom, nullptr);
+  }
+
+  virtual void TearDown() {
+    mManager->Destroy();
+  }
+
+  void AddTopLayer(Layer* aLayer) {
+    aLayer->SetContentFlags(Layer::CONTENT_OPAQUE);
+    aLayer->AsLayerComposite()->SetShadowVisibleRegion(nsIntRect(0, 0, 100, 50));
+    mRoot->InsertAfter(aLayer, mBottom);
+  }
+
+  void Cull() {
+    nsIntRegion opaque;
+    LayerManagerComposite::ApplyOcclusionCulling(mRoot, opaque, mCulled);
+  }
+
+  const nsIntRegion& BottomVisibleRegion() {
+    return mBottom->GetShadowVisibleRegion();
+  }
+
+  nsRefPtr<LayerManagerComposite> mManager;
+  nsRefPtr<ContainerLayerComposite> mRoot;
+  nsRefPtr<ColorLayerComposite> mBottom;
+  nsTArray<LayerManagerComposite::CulledVisibleRegion> mCulled;
+};
+
+TEST_F(LayerOcclusion, OpaqueLayerOccludes) {
+  nsRefPtr<ColorLayerComposite> top = mManager->CreateColorLayerComposite();
+  AddTopLayer(top);
+  Cull();
+
+  EXPECT_EQ(nsIntRegion(nsIntRect(0, 50, 100, 50)), BottomVisibleRegion());
+  EXPECT_EQ(nsIntRegion(nsIntRect(0, 0, 100, 50)), top->GetShadowVisibleRegion());
+  ASSERT_EQ(1u, mCulled.Length());
+
+  LayerManagerComposite::RestoreCulledVisibleRegions(mCulled);
+  EXPECT_EQ(nsIntRegion(nsIntRect(0, 0, 100, 100)), BottomVisibleRegion());
+}
+
+TEST_F(LayerOcclusion, TranslatedLayerOccludes) {
+  nsRefPtr<ColorLayerComposite> top = mManager->CreateColorLayerComposite();
+  AddTopLayer(top);
+  top->SetShadowTransform(Matrix4x4().Translate(0, 50, 0));
+  Cull();
+
+  EXPECT_EQ(nsIntRegion(nsIntRect(0, 0, 100, 50)), BottomVisibleRegion());
+
+  LayerManagerComposite::RestoreCulledVisibleRegions(mCulled);
+  EXPECT_EQ(nsIntRegion(nsIntRect(0, 0, 100, 100)), BottomVisibleRegion());
+}
+
+TEST_F(LayerOcclusion, NonOpaqueLayerDoesNotOcclude) {
+  nsRefPtr<ColorLayerComposite> top = mManager->CreateColorLayerComposite();
+  AddTopLayer(top);
+  top->SetContentFlags(0);
+  Cull();
+
+  EXPECT_EQ(nsIntRegion(nsIntRect(0, 0, 100, 100)), BottomVisibleRegion());
+  EXPECT_TRUE(mCulled.IsEmpty());
+}
+
+TEST_F(LayerOcclusion, TranslucentLayerDoesNotOcclude) {
+  nsRefPtr<ColorLayerComposite> top = mManager->CreateColorLayerComposite();
+  AddTopLayer(top);
+  top->SetShadowOpacity(0.5f);
+  Cull();
+
+  EXPECT_EQ(nsIntRegion(nsIntRect(0, 0, 100, 100)), BottomVisibleRegion());
+  EXPECT_TRUE(mCulled.IsEmpty());
+}
+
+TEST_F(LayerOcclusion, MixBlendLayerDoesNotOcclude) {
+  nsRefPtr<ColorLayerComposite> top = mManager->CreateColorLayerComposite();
+  AddTopLayer(top);
+  top->SetMixBlendMode(CompositionOp::OP_MULTIPLY);
+  Cull();
+
+  EXPECT_EQ(nsIntRegion(nsIntRect(0, 0, 100, 100)), BottomVisibleRegion());
+  EXPECT_TRUE(mCulled.IsEmpty());
+}
+
+TEST_F(LayerOcclusion, MaskedLayerDoesNotOcclude) {
+  nsRefPtr<ColorLayerComposite> top = mManager->CreateColorLayerComposite();
+  nsRefPtr<ImageLayerComposite> mask = mManager->CreateImageLayerComposite();
+  AddTopLayer(top);
+  top->SetMaskLayer(mask);
+  Cull();
+
+  EXPECT_EQ(nsIntRegion(nsIntRect(0, 0, 100, 100)), BottomVisibleRegion());
+  EXPECT_TRUE(mCulled.IsEmpty());
+
+  top->SetMaskLayer(nullptr);
+  mask->Destroy();
+}
+
+TEST_F(LayerOcclusion, ScaledLayerDoesNotOcclude) {
+  nsRefPtr<ColorLayerComposite> top = mManager->CreateColorLayerComposite();
+  AddTopLayer(top);
+  top->SetShadowTransform(Matrix4x4().Scale(2, 2, 1));
+  Cull();
+
+  EXPECT_EQ(nsIntRegion(nsIntRect(0, 0, 100, 100)), BottomVisibleRegion());
+  EXPECT_TRUE(mCulled.IsEmpty());
+}
+
+TEST_F(LayerOcclusion, LayerWithoutContentDoesNotOcclude) {
+  // An opaque painted layer that hasn't been given a buffer draws nothing.
+  nsRefPtr<PaintedLayerComposite> top = mManager->CreatePaintedLayerComposite();
+  AddTopLayer(top);
+  top->SetValidRegion(nsIntRect(0, 0, 100, 50));
+  Cull();
+
+  EXPECT_EQ(nsIntRegion(nsIntRect(0, 0, 100, 100)), BottomVisibleRegion());
+  EXPECT_TRUE(mCulled.IsEmpty());
+}
@@ -458,6 +458,40 @@ void TestVisit(nsRegion &r)
   res.compare(ref);
 }
 
+TEST(Gfx, RegionIntersects)
+{
+  { // empty regions and empty rects never intersect
+    nsRegion r;
+    EXPECT_FALSE(r.Intersects(nsRect(0, 0, 10, 10)));
+
+    r = nsRect(0, 0, 100, 100);
+    EXPECT_FALSE(r.Intersects(nsRect(50, 50, 0, 0)));
+  }
+
+  { // two bands, with a hole in the middle of the bounds
+    // +--+    +--+
+    // |  |    |  |
+    // +--+    +--+
+    //     +--+
+    //     |  |
+    //     +--+
+    nsRegion r(nsRect(0, 0, 10, 10));
+    r.OrWith(nsRect(20, 0, 10, 10));
+    r.OrWith(nsRect(10, 10, 10, 10));
+
+    EXPECT_TRUE(r.Intersects(nsRect(5, 5, 1, 1)));
+    EXPECT_TRUE(r.Intersects(nsRect(25, 5, 1, 1)));
+    EXPECT_TRUE(r.Intersects(nsRect(15, 15, 1, 1)));
+    EXPECT_TRUE(r.Intersects(nsRect(9, 9, 2, 2)));
+
+    EXPECT_FALSE(r.Intersects(nsRect(12, 2, 6, 6)));
+    EXPECT_FALSE(r.Intersects(nsRect(2, 12, 6, 6)));
+    EXPECT_FALSE(r.Intersects(nsRect(22, 12, 6, 6)));
+    EXPECT_FALSE(r.Intersects(nsRect(10, 0, 10, 10)));
+    EXPECT_FALSE(r.Intersects(nsRect(0, 20, 30, 10)));
+  }
+}
+
 TEST(Gfx, RegionVisitEdges) {
   { // visit edges
     nsRegion r(nsRect(20, 20, 100, 100));
@@ -6,6 +6,7 @@
 #include "gfxBlur.h"
 #include "gfxContext.h"
 #include "gfxPlatform.h"
+#include "gfxPrefs.h"
 
 #include "mozilla/gfx/Blur.h"
 #include "mozilla/gfx/2D.h"
@@ -162,13 +163,20 @@ struct BlurCacheKey : public PLDHashEntryHdr {
   typedef const BlurCacheKey* KeyTypePointer;
   enum { ALLOW_MEMMOVE = true };
 
+  // mRect and mSkipRect are relative to the integer part of the shadow
+  // rect's position, so that identical shadows at different positions share
+  // an entry.
   gfxRect mRect;
+  gfxCornerSizes mCornerRadii;
   gfxIntSize mBlurRadius;
   gfxRect mSkipRect;
   BackendType mBackend;
 
-  BlurCacheKey(const gfxRect& aRect, const gfxIntSize &aBlurRadius, const gfxRect& aSkipRect, BackendType aBackend)
+  BlurCacheKey(const gfxRect& aRect, const gfxCornerSizes& aCornerRadii,
+               const gfxIntSize &aBlurRadius, const gfxRect& aSkipRect,
+               BackendType aBackend)
     : mRect(aRect)
+    , mCornerRadii(aCornerRadii)
     , mBlurRadius(aBlurRadius)
     , mSkipRect(aSkipRect)
     , mBackend(aBackend)
@@ -176,6 +184,7 @@ struct BlurCacheKey : public PLDHashEntryHdr {
 
   explicit BlurCacheKey(const BlurCacheKey* aOther)
     : mRect(aOther->mRect)
+    , mCornerRadii(aOther->mCornerRadii)
     , mBlurRadius(aOther->mBlurRadius)
     , mSkipRect(aOther->mSkipRect)
     , mBackend(aOther->mBackend)
@@ -185,6 +194,8 @@ struct BlurCacheKey : public PLDHashEntryHdr {
   HashKey(const KeyTypePointer aKey)
   {
     PLDHashNumber hash = HashBytes(&aKey->mRect.x, 4 * sizeof(gfxFloat));
+    hash = AddToHash(hash, HashBytes(&aKey->mCornerRadii.sizes[0].width,
+                                     2 * NS_NUM_CORNERS * sizeof(gfxFloat)));
     hash = AddToHash(hash, aKey->mBlurRadius.width, aKey->mBlurRadius.height);
     hash = AddToHash(hash, HashBytes(&aKey->mSkipRect.x, 4 * sizeof(gfxFloat)));
     hash = AddToHash(hash, (uint32_t)aKey->mBackend);
@@ -193,6 +204,11 @@ struct BlurCacheKey : public PLDHashEntryHdr {
 
   bool KeyEquals(KeyTypePointer aKey) const
   {
+    for (int i = 0; i < NS_NUM_CORNERS; i++) {
+      if (aKey->mCornerRadii.sizes[i] != mCornerRadii.sizes[i]) {
+        return false;
+      }
+    }
     if (aKey->mRect.IsEqualInterior(mRect) &&
         aKey->mBlurRadius == mBlurRadius &&
         aKey->mSkipRect.IsEqualInterior(mSkipRect) &&
@@ -258,13 +274,15 @@ class BlurCache MOZ_FINAL : public nsExpirationTracker<BlurCacheData,4>
     }
 
     BlurCacheData* Lookup(const gfxRect& aRect,
+                          const gfxCornerSizes& aCornerRadii,
                           const gfxIntSize& aBlurRadius,
                           const gfxRect& aSkipRect,
                           BackendType aBackendType,
                           const gfxRect* aDirtyRect)
     {
       BlurCacheData* blur =
-        mHashEntries.Get(BlurCacheKey(aRect, aBlurRadius, aSkipRect, aBackendType));
+        mHashEntries.Get(BlurCacheKey(aRect, aCornerRadii, aBlurRadius,
+                                      aSkipRect, aBackendType));
 
       if (blur) {
         if (aDirtyRect && !blur->mDirtyRect.Contains(*aDirtyRect)) {
@@ -304,9 +322,14 @@ class BlurCache MOZ_FINAL : public nsExpirationTracker<BlurCacheData,4>
 
 static BlurCache* gBlurCache = nullptr;
 
+// Lookup statistics, logged when gfx.blur.cache.log-stats is set.
+static uint32_t gBlurCacheHits = 0;
+static uint32_t gBlurCacheMisses = 0;
+
 SourceSurface*
 GetCachedBlur(DrawTarget *aDT,
               const gfxRect& aRect,
+              const gfxCornerSizes& aCornerRadii,
               const gfxIntSize& aBlurRadius,
               const gfxRect& aSkipRect,
               const gfxRect& aDirtyRect,
@@ -315,9 +338,20 @@ GetCachedBlur(DrawTarget *aDT,
   if (!gBlurCache) {
     gBlurCache = new BlurCache();
   }
-  BlurCacheData* cached = gBlurCache->Lookup(aRect, aBlurRadius, aSkipRect,
-                                             aDT->GetBackendType(),
+  BlurCacheData* cached = gBlurCache->Lookup(aRect, aCornerRadii, aBlurRadius,
+                                             aSkipRect, aDT->GetBackendType(),
                                              &aDirtyRect);
+  if (cached) {
+    gBlurCacheHits++;
+  } else {
+    gBlurCacheMisses++;
+  }
+  if (gfxPrefs::BlurCacheLogStats() &&
+      (gBlurCacheHits + gBlurCacheMisses) % 256 == 0) {
+    printf_stderr("Blur cache: %u hits, %u misses\n",
+                  gBlurCacheHits, gBlurCacheMisses);
+  }
+
   if (cached) {
     *aTopLeft = cached->mTopLeft;
     return cached->mBlur;
@@ -328,6 +362,7 @@ GetCachedBlur(DrawTarget *aDT,
 void
 CacheBlur(DrawTarget *aDT,
           const gfxRect& aRect,
+          const gfxCornerSizes& aCornerRadii,
           const gfxIntSize& aBlurRadius,
           const gfxRect& aSkipRect,
           SourceSurface* aBlur,
@@ -336,7 +371,8 @@ CacheBlur(DrawTarget *aDT,
 {
   // If we already had a cached value with this key, but an incorrect dirty region then just update
   // the existing entry
-  if (BlurCacheData* cached = gBlurCache->Lookup(aRect, aBlurRadius, aSkipRect,
+  if (BlurCacheData* cached = gBlurCache->Lookup(aRect, aCornerRadii,
+                                                 aBlurRadius, aSkipRect,
                                                  aDT->GetBackendType(),
                                                  nullptr)) {
     cached->mBlur = aBlur;
@@ -345,7 +381,8 @@ CacheBlur(DrawTarget *aDT,
     return;
   }
 
-  BlurCacheKey key(aRect, aBlurRadius, aSkipRect, aDT->GetBackendType());
+  BlurCacheKey key(aRect, aCornerRadii, aBlurRadius, aSkipRect,
+                   aDT->GetBackendType());
   BlurCacheData* data = new BlurCacheData(aBlur, aTopLeft, aDirtyRect, key);
   if (!gBlurCache->RegisterEntry(data)) {
     delete data;
@@ -376,9 +413,22 @@ gfxAlphaBoxBlur::BlurRectangle(gfxContext *aDestinationCtx,
     return;
   }
 
+  // Cache entries are stored relative to the integer part of the shadow's
+  // position; translating by whole pixels doesn't change the blurred mask.
+  IntPoint offset(int32_t(floor(aRect.x)), int32_t(floor(aRect.y)));
+  gfxPoint cacheOffset(offset.x, offset.y);
+  gfxRect cacheRect = aRect - cacheOffset;
+  gfxRect cacheSkipRect = aSkipRect - cacheOffset;
+  gfxRect cacheDirtyRect = aDirtyRect - cacheOffset;
+  gfxCornerSizes cornerRadii = aCornerRadii ? *aCornerRadii : gfxCornerSizes(0.0);
+
   IntPoint topLeft;
-  RefPtr<SourceSurface> surface = GetCachedBlur(dt, aRect, blurRadius, aSkipRect, aDirtyRect, &topLeft);
-  if (!surface) {
+  RefPtr<SourceSurface> surface =
+    GetCachedBlur(dt, cacheRect, cornerRadii, blurRadius, cacheSkipRect,
+                  cacheDirtyRect, &topLeft);
+  if (surface) {
+    topLeft += offset;
+  } else {
     // Create the temporary surface for blurring
     gfxAlphaBoxBlur blur;
     gfxContext *dest = blur.Init(aRect, gfxIntSize(), blurRadius, &aDirtyRect, &aSkipRect);
@@ -402,7 +452,8 @@ gfxAlphaBoxBlur::BlurRectangle(gfxContext *aDestinationCtx,
     if (!surface) {
       return;
     }
-    CacheBlur(dt, aRect, blurRadius, aSkipRect, surface, topLeft, aDirtyRect);
+    CacheBlur(dt, cacheRect, cornerRadii, blurRadius, cacheSkipRect, surface,
+              topLeft - offset, cacheDirtyRect);
   }
 
   aDestinationCtx->SetColor(aShadowColor);
@@ -20,8 +20,11 @@ using namespace mozilla;
 struct GradientCacheKey : public PLDHashEntryHdr {
   typedef const GradientCacheKey& KeyType;
   typedef const GradientCacheKey* KeyTypePointer;
-  enum { ALLOW_MEMMOVE = true };
-  const nsTArray<GradientStop> mStops;
+  // mStops keeps its elements inline, so the key can't be memmoved.
+  enum { ALLOW_MEMMOVE = false };
+  // A key is constructed for every lookup, so store a few stops inline to
+  // avoid a heap allocation for the common case of short gradients.
+  const nsAutoTArray<GradientStop, 4> mStops;
   ExtendMode mExtend;
   BackendType mBackendType;
 
@@ -37,6 +37,8 @@ gfxHarfBuzzShaper::gfxHarfBuzzShaper(gfxFont *aFont)
     : gfxFontShaper(aFont),
       mHBFace(aFont->GetFontEntry()->GetHBFace()),
       mHBFont(nullptr),
+      mBuffer(nullptr),
+      mLastLanguage(HB_LANGUAGE_INVALID),
       mKernTable(nullptr),
       mHmtxTable(nullptr),
       mVmtxTable(nullptr),
@@ -68,6 +70,9 @@ gfxHarfBuzzShaper::~gfxHarfBuzzShaper()
     if (mHBFont) {
         hb_font_destroy(mHBFont);
     }
+    if (mBuffer) {
+        hb_buffer_destroy(mBuffer);
+    }
     if (mHBFace) {
         hb_face_destroy(mHBFace);
     }
@@ -1212,8 +1217,15 @@ gfxHarfBuzzShaper::ShapeText(gfxContext      *aContext,
     }
 
     bool isRightToLeft = aShapedText->IsRightToLeft();
-    hb_buffer_t *buffer = hb_buffer_create();
-    hb_buffer_set_unicode_funcs(buffer, sHBUnicodeFuncs);
+    if (!mBuffer) {
+        mBuffer = hb_buffer_create();
+        hb_buffer_set_unicode_funcs(mBuffer, sHBUnicodeFuncs);
+    } else {
+        // Drops the previous run's glyphs and segment properties but keeps
+        // the unicode funcs and the allocated storage.
+        hb_buffer_clear_contents(mBuffer);
+    }
+    hb_buffer_t *buffer = mBuffer;
 
     hb_buffer_set_direction(buffer,
                             aVertical ? HB_DIRECTION_TTB :
@@ -1233,10 +1245,14 @@ gfxHarfBuzzShaper::ShapeText(gfxContext      *aContext,
     } else if (entry->mLanguageOverride) {
         language = hb_ot_tag_to_language(entry->mLanguageOverride);
     } else {
-        nsCString langString;
-        style->language->ToUTF8String(langString);
-        language =
-            hb_language_from_string(langString.get(), langString.Length());
+        if (style->language != mLastLanguageAtom) {
+            nsCString langString;
+            style->language->ToUTF8String(langString);
+            mLastLanguage =
+                hb_language_from_string(langString.get(), langString.Length());
+            mLastLanguageAtom = style->language;
+        }
+        language = mLastLanguage;
     }
     hb_buffer_set_language(buffer, language);
 
@@ -1255,7 +1271,6 @@ gfxHarfBuzzShaper::ShapeText(gfxContext      *aContext,
                                    aText, buffer, aVertical);
 
     NS_WARN_IF_FALSE(NS_SUCCEEDED(rv), "failed to store glyphs into gfxShapedWord");
-    hb_buffer_destroy(buffer);
 
     return NS_SUCCEEDED(rv);
 }
@@ -116,6 +116,16 @@ protected:
     // size-specific font object, owned by the gfxHarfBuzzShaper
     hb_font_t         *mHBFont;
 
+    // Buffer reused for each ShapeText call rather than being allocated and
+    // freed for every word; created lazily, owned by the gfxHarfBuzzShaper.
+    hb_buffer_t       *mBuffer;
+
+    // The harfbuzz language most recently derived from a style's language
+    // atom, so that we don't convert the same atom to a string and look it
+    // up again for every word.
+    nsCOMPtr<nsIAtom>  mLastLanguageAtom;
+    hb_language_t      mLastLanguage;
+
     FontCallbackData   mCallbackData;
 
     // Following table references etc are declared "mutable" because the
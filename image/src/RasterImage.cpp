@@ -3216,6 +3216,12 @@ RasterImage::DecodePool::RequestDecode(RasterImage* aImg)
       return;
     }
 
+    // Lock counts only change on the main thread. Requests made from decoder
+    // threads, to continue an earlier decode, keep that decode's priority.
+    if (NS_IsMainThread()) {
+      aImg->mDecodeRequest->mIsHighPriority = aImg->mLockCount > 0;
+    }
+
     aImg->mDecodeRequest->mRequestStatus = DecodeRequest::REQUEST_PENDING;
     nsRefPtr<DecodeJob> job = new DecodeJob(aImg->mDecodeRequest, aImg);
 
@@ -3223,11 +3229,43 @@ RasterImage::DecodePool::RequestDecode(RasterImage* aImg)
     if (!gfxPrefs::ImageMTDecodingEnabled() || !mThreadPool) {
       NS_DispatchToMainThread(job);
     } else {
-      mThreadPool->Dispatch(job, nsIEventTarget::DISPATCH_NORMAL);
+      if (aImg->mDecodeRequest->mIsHighPriority) {
+        mHighPriorityJobs.AppendElement(job);
+      } else {
+        mLowPriorityJobs.AppendElement(job);
+      }
+      nsRefPtr<DecodeWorker> worker = new DecodeWorker();
+      mThreadPool->Dispatch(worker, nsIEventTarget::DISPATCH_NORMAL);
     }
   }
 }
 
+already_AddRefed<RasterImage::DecodePool::DecodeJob>
+RasterImage::DecodePool::PopJob()
+{
+  MutexAutoLock threadPoolLock(mThreadPoolMutex);
+
+  nsTArray<nsRefPtr<DecodeJob>>& queue =
+    mHighPriorityJobs.IsEmpty() ? mLowPriorityJobs : mHighPriorityJobs;
+  if (queue.IsEmpty()) {
+    return nullptr;
+  }
+
+  nsRefPtr<DecodeJob> job = queue[0].forget();
+  queue.RemoveElementAt(0);
+  return job.forget();
+}
+
+NS_IMETHODIMP
+RasterImage::DecodePool::DecodeWorker::Run()
+{
+  nsRefPtr<DecodeJob> job = DecodePool::Singleton()->PopJob();
+  if (job) {
+    job->Run();
+  }
+  return NS_OK;
+}
+
 void
 RasterImage::DecodePool::DecodeABitOf(RasterImage* aImg, DecodeStrategy aStrategy)
 {
@@ -333,6 +333,7 @@ private:
       , mRequestStatus(REQUEST_INACTIVE)
       , mChunkCount(0)
       , mAllocatedNewFrame(false)
+      , mIsHighPriority(false)
     {
       MOZ_ASSERT(aImage, "aImage cannot be null");
       MOZ_ASSERT(aImage->mStatusTracker,
@@ -370,6 +371,11 @@ private:
      * been called to flush data to it */
     bool mAllocatedNewFrame;
 
+    /* True if the image was locked (e.g. because it's visible) the last time
+     * a decode was requested for it on the main thread. The DecodePool runs
+     * these requests ahead of those for unlocked images. */
+    bool mIsHighPriority;
+
   private:
     ~DecodeRequest() {}
   };
@@ -476,13 +482,30 @@ private:
       nsRefPtr<RasterImage> mImage;
     };
 
+    /* Dispatched to the thread pool once for every DecodeJob queued by
+     * RequestDecode. Runs the highest priority job waiting at the time it
+     * runs, rather than the job it was dispatched for.
+     */
+    class DecodeWorker : public nsRunnable
+    {
+    public:
+      NS_IMETHOD Run();
+    };
+
+    /* Removes and returns the oldest high priority job, or if there are none
+     * the oldest low priority job. */
+    already_AddRefed<DecodeJob> PopJob();
+
   private: /* members */
 
-    // mThreadPoolMutex protects mThreadPool. For all RasterImages R,
-    // R::mDecodingMonitor must be acquired before mThreadPoolMutex
-    // if both are acquired; the other order may cause deadlock.
+    // mThreadPoolMutex protects mThreadPool and the job queues. For all
+    // RasterImages R, R::mDecodingMonitor must be acquired before
+    // mThreadPoolMutex if both are acquired; the other order may cause
+    // deadlock.
     Mutex                     mThreadPoolMutex;
     nsCOMPtr<nsIThreadPool>   mThreadPool;
+    nsTArray<nsRefPtr<DecodeJob>> mHighPriorityJobs;
+    nsTArray<nsRefPtr<DecodeJob>> mLowPriorityJobs;
   };
 
   class DecodeDoneWorker : public nsRunnable
@@ -254,6 +254,7 @@ protected:
   uMappingTable             * mMappingTable;
   char16_t                 mFastTable[ONE_BYTE_TABLE_SIZE];
   bool                      mFastTableCreated;
+  bool                      mFastTableIsASCIICompatible;
   mozilla::Mutex            mFastTableMutex;
 
   //--------------------------------------------------------------------
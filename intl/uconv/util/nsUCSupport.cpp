@@ -267,6 +267,7 @@ nsOneByteDecoderSupport::nsOneByteDecoderSupport(
   : nsBasicDecoderSupport()
   , mMappingTable(aMappingTable)
   , mFastTableCreated(false)
+  , mFastTableIsASCIICompatible(false)
   , mFastTableMutex("nsOneByteDecoderSupport mFastTableMutex")
 {
 }
@@ -290,6 +291,13 @@ NS_IMETHODIMP nsOneByteDecoderSupport::Convert(const char * aSrc,
       nsresult res = nsUnicodeDecodeHelper::CreateFastTable(
                          mMappingTable, mFastTable, ONE_BYTE_TABLE_SIZE);
       if (NS_FAILED(res)) return res;
+      mFastTableIsASCIICompatible = true;
+      for (char16_t c = 0; c < 0x80; c++) {
+        if (mFastTable[c] != c) {
+          mFastTableIsASCIICompatible = false;
+          break;
+        }
+      }
       mFastTableCreated = true;
     }
   }
@@ -298,7 +306,8 @@ NS_IMETHODIMP nsOneByteDecoderSupport::Convert(const char * aSrc,
                                                    aDest, aDestLength,
                                                    mFastTable,
                                                    ONE_BYTE_TABLE_SIZE,
-                                                   mErrBehavior == kOnError_Signal);
+                                                   mErrBehavior == kOnError_Signal,
+                                                   mFastTableIsASCIICompatible);
 }
 
 NS_IMETHODIMP nsOneByteDecoderSupport::GetMaxLength(const char * aSrc,
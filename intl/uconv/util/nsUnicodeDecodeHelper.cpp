@@ -7,6 +7,8 @@
 #include "nsUnicodeDecodeHelper.h"
 #include "nsAutoPtr.h"
 
+#include <string.h>
+
 //----------------------------------------------------------------------
 // Class nsUnicodeDecodeHelper [implementation]
 nsresult nsUnicodeDecodeHelper::ConvertByTable(
@@ -187,7 +189,8 @@ nsresult nsUnicodeDecodeHelper::ConvertByFastTable(
                                      int32_t * aDestLength, 
                                      const char16_t * aFastTable, 
                                      int32_t aTableSize,
-                                     bool aErrorSignal)
+                                     bool aErrorSignal,
+                                     bool aASCIICompatible)
 {
   uint8_t * src = (uint8_t *)aSrc;
   uint8_t * srcEnd = src;
@@ -203,6 +206,24 @@ nsresult nsUnicodeDecodeHelper::ConvertByFastTable(
   }
 
   for (; src<srcEnd;) {
+    if (aASCIICompatible) {
+      // The table maps ASCII to itself, so runs of it need neither a lookup
+      // nor an error check. Skip over them four bytes at a time.
+      while (srcEnd - src >= 4) {
+        uint32_t word;
+        memcpy(&word, src, sizeof(word));
+        if (word & 0x80808080U)
+          break;
+        dest[0] = src[0];
+        dest[1] = src[1];
+        dest[2] = src[2];
+        dest[3] = src[3];
+        src += 4;
+        dest += 4;
+      }
+      if (src == srcEnd)
+        break;
+    }
     *dest = aFastTable[*src];
     if (*dest == 0xfffd && aErrorSignal) {
       res = NS_ERROR_ILLEGAL_INPUT;
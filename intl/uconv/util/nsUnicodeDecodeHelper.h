@@ -37,11 +37,12 @@ public:
       uMappingTable ** aMappingTable, bool aErrorSignal = false);
 
   /**
-   * Converts data using a fast lookup table.
+   * Converts data using a fast lookup table. If aASCIICompatible is true,
+   * the table must map every byte below 0x80 to the same code point.
    */
   static nsresult ConvertByFastTable(const char * aSrc, int32_t * aSrcLength, 
       char16_t * aDest, int32_t * aDestLength, const char16_t * aFastTable, 
-      int32_t aTableSize, bool aErrorSignal);
+      int32_t aTableSize, bool aErrorSignal, bool aASCIICompatible = false);
 
   /**
    * Create a cache-like fast lookup table from a normal one.
@@ -636,6 +636,19 @@ bool Channel::ChannelImpl::ProcessIncomingMessages() {
       // p is from input_overflow_buf_
       input_overflow_buf_.erase(0, p - overflowp);
     }
+
+    // The overflow buffer now starts with a partial message. Once we know how
+    // big that message is, make room for all of it at once rather than
+    // growing (and copying) the buffer a read at a time.
+    if (!input_overflow_buf_.empty()) {
+      size_t messageSize =
+        Message::MessageSize(input_overflow_buf_.data(),
+                             input_overflow_buf_.data() + input_overflow_buf_.size());
+      if (messageSize > input_overflow_buf_.capacity() &&
+          messageSize <= static_cast<size_t>(kMaximumMessageSize)) {
+        input_overflow_buf_.reserve(messageSize);
+      }
+    }
     input_overflow_fds_ = std::vector<int>(&fds[fds_i], &fds[num_fds]);
 
     // When the input data buffer is empty, the overflow fds should be too. If
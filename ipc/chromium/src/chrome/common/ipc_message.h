@@ -244,6 +244,15 @@ class Message : public Pickle {
     return Pickle::FindNext(sizeof(Header), range_start, range_end);
   }
 
+  // Returns the total size of the message whose data starts at range_start,
+  // or 0 if its header isn't entirely contained in the given data range.
+  static size_t MessageSize(const char* range_start, const char* range_end) {
+    if (range_end - range_start < static_cast<ptrdiff_t>(sizeof(Header)))
+      return 0;
+    const Header* hdr = reinterpret_cast<const Header*>(range_start);
+    return sizeof(Header) + static_cast<size_t>(hdr->payload_size);
+  }
+
 #if defined(OS_POSIX)
   // On POSIX, a message supports reading / writing FileDescriptor objects.
   // This is used to pass a file descriptor to the peer of an IPC channel.
@@ -11,6 +11,8 @@
 #include "mozilla/Assertions.h"
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Move.h"
+#include "mozilla/Telemetry.h"
+#include "mozilla/TimeStamp.h"
 #include "nsDebug.h"
 #include "nsISupportsImpl.h"
 #include "nsContentUtils.h"
@@ -627,8 +629,10 @@ MessageChannel::Send(Message* aMsg, Message* aReply)
     IPC_ASSERT(!AwaitingSyncReply(), "nested sync messages are not supported");
 
     AutoEnterPendingReply replies(mPendingSyncReplies);
+    TimeStamp start = TimeStamp::Now();
     if (!SendAndWait(aMsg, aReply))
         return false;
+    Telemetry::AccumulateTimeDelta(Telemetry::IPC_SYNC_LATENCY_MS, start);
 
     NS_ABORT_IF_FALSE(aReply->is_sync(), "reply is not sync");
     return true;
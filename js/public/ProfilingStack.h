@@ -168,6 +168,21 @@ RegisterRuntimeProfilingEventMarker(JSRuntime *rt, void (*fn)(const char *));
 JS_FRIEND_API(jsbytecode*)
 ProfilingGetPC(JSRuntime *rt, JSScript *script, void *ip);
 
+/*
+ * Describe the JS frames active at |addr|, an address inside Baseline or Ion
+ * code such as a return address found while walking the native stack. Up to
+ * |maxLabels| profiler labels are stored in |labels|, innermost frame first,
+ * including any frames which Ion inlined into the outermost script. Returns
+ * the total number of frames, which may exceed |maxLabels|, or zero if |addr|
+ * is not in JIT code with a native to bytecode map.
+ *
+ * This must be called on the runtime's thread and not from a signal handler,
+ * so samplers should record raw addresses and resolve them while streaming.
+ * Addresses in code which has since been discarded are not found.
+ */
+JS_FRIEND_API(uint32_t)
+ProfilingDescribeJitCode(JSRuntime *rt, void *addr, const char **labels, uint32_t maxLabels);
+
 } // namespace js
 
 #endif  /* js_ProfilingStack_h */
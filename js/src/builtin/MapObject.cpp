@@ -1010,7 +1010,7 @@ MapIteratorObject::next(JSContext *cx, unsigned argc, Value *vp)
 const Class MapObject::class_ = {
     "Map",
     JSCLASS_HAS_PRIVATE | JSCLASS_IMPLEMENTS_BARRIERS |
-    JSCLASS_HAS_CACHED_PROTO(JSProto_Map),
+    JSCLASS_HAS_CACHED_PROTO(JSProto_Map) | JSCLASS_BACKGROUND_FINALIZE,
     JS_PropertyStub,         // addProperty
     JS_DeletePropertyStub,   // delProperty
     JS_PropertyStub,         // getProperty
@@ -1215,6 +1215,15 @@ MapObject::create(JSContext *cx)
     return &obj->as<MapObject>();
 }
 
+/*
+ * Maps and sets are finalized on the background sweep thread. This is safe
+ * because the only other things that point into the table are the Ranges
+ * owned by Map and Set iterators. An iterator keeps its target alive, so when
+ * the table is dead its iterators are dead too, and iterators are finalized
+ * in the foreground (see queueObjectsForSweep) before background sweeping
+ * starts. The table's keys and values need no barriers here: they are
+ * tenured, as a minor GC always precedes sweeping.
+ */
 void
 MapObject::finalize(FreeOp *fop, JSObject *obj)
 {
@@ -1655,7 +1664,7 @@ SetIteratorObject::next(JSContext *cx, unsigned argc, Value *vp)
 const Class SetObject::class_ = {
     "Set",
     JSCLASS_HAS_PRIVATE | JSCLASS_IMPLEMENTS_BARRIERS |
-    JSCLASS_HAS_CACHED_PROTO(JSProto_Set),
+    JSCLASS_HAS_CACHED_PROTO(JSProto_Set) | JSCLASS_BACKGROUND_FINALIZE,
     JS_PropertyStub,         // addProperty
     JS_DeletePropertyStub,   // delProperty
     JS_PropertyStub,         // getProperty
@@ -1769,6 +1778,7 @@ SetObject::mark(JSTracer *trc, JSObject *obj)
     }
 }
 
+/* See the comment above MapObject::finalize. */
 void
 SetObject::finalize(FreeOp *fop, JSObject *obj)
 {
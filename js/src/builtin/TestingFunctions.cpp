@@ -295,11 +295,12 @@ static const struct ParamPair {
     {"sliceTimeBudget",     JSGC_SLICE_TIME_BUDGET},
     {"markStackLimit",      JSGC_MARK_STACK_LIMIT},
     {"minEmptyChunkCount",  JSGC_MIN_EMPTY_CHUNK_COUNT},
-    {"maxEmptyChunkCount",  JSGC_MAX_EMPTY_CHUNK_COUNT}
+    {"maxEmptyChunkCount",  JSGC_MAX_EMPTY_CHUNK_COUNT},
+    {"maxNurseryBytes",     JSGC_MAX_NURSERY_BYTES}
 };
 
 // Keep this in sync with above params.
-#define GC_PARAMETER_ARGS_LIST "maxBytes, maxMallocBytes, gcBytes, gcNumber, sliceTimeBudget, or markStackLimit"
+#define GC_PARAMETER_ARGS_LIST "maxBytes, maxMallocBytes, gcBytes, gcNumber, sliceTimeBudget, markStackLimit, minEmptyChunkCount, maxEmptyChunkCount, or maxNurseryBytes"
 
 static bool
 GCParameter(JSContext *cx, unsigned argc, Value *vp)
@@ -928,7 +929,20 @@ SaveStack(JSContext *cx, unsigned argc, jsval *vp)
 static bool
 EnableTrackAllocations(JSContext *cx, unsigned argc, jsval *vp)
 {
-    SetObjectMetadataCallback(cx, SavedStacksMetadataCallback);
+    CallArgs args = CallArgsFromVp(argc, vp);
+
+    double probability = 1.0;
+    if (args.length() >= 1) {
+        if (!ToNumber(cx, args[0], &probability))
+            return false;
+        if (!(probability >= 0.0 && probability <= 1.0)) {
+            JS_ReportError(cx, "sampling probability must be between 0 and 1");
+            return false;
+        }
+    }
+
+    SetAllocationSamplingProbability(cx, probability);
+    args.rval().setUndefined();
     return true;
 }
 
@@ -2125,8 +2139,9 @@ static const JSFunctionSpecWithHelp TestingFunctions[] = {
 "  Capture a stack.\n"),
 
     JS_FN_HELP("enableTrackAllocations", EnableTrackAllocations, 0, 0,
-"enableTrackAllocations()",
-"  Start capturing the JS stack at every allocation. Note that this sets an "
+"enableTrackAllocations([probability])",
+"  Start capturing the JS stack at every allocation, or at a random sample of "
+"  allocations if a probability is given. Note that this sets an "
 "  object metadata callback that will override any other object metadata "
 "  callback that may be set."),
 
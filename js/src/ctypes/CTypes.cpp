@@ -5351,22 +5351,48 @@ struct AutoValue
 {
   AutoValue() : mData(nullptr) { }
 
+  AutoValue(AutoValue&& aOther)
+    : mData(aOther.mData)
+  {
+    // Vector may move us around when it grows; don't keep pointing into the
+    // old element's inline buffer, and don't let it free what we now own.
+    if (aOther.mData == aOther.mInline) {
+      memcpy(mInline, aOther.mInline, sizeof(mInline));
+      mData = mInline;
+    }
+    aOther.mData = nullptr;
+  }
+
   ~AutoValue()
   {
-    js_free(mData);
+    if (mData != mInline)
+      js_free(mData);
   }
 
   bool SizeToType(JSContext* cx, JSObject* type)
   {
     // Allocate a minimum of sizeof(ffi_arg) to handle small integers.
     size_t size = Align(CType::GetSize(type), sizeof(ffi_arg));
-    mData = js_malloc(size);
-    if (mData)
-      memset(mData, 0, size);
-    return mData != nullptr;
+    if (size <= sizeof(mInline)) {
+      mData = mInline;
+    } else {
+      mData = js_malloc(size);
+      if (!mData)
+        return false;
+    }
+    memset(mData, 0, size);
+    return true;
   }
 
   void* mData;
+
+  // Primitive types, pointers and small structs fit here, which saves a heap
+  // allocation per argument on most calls.
+  uint64_t mInline[2];
+
+private:
+  AutoValue(const AutoValue&) MOZ_DELETE;
+  AutoValue& operator=(const AutoValue&) MOZ_DELETE;
 };
 
 static bool
@@ -5888,6 +5914,16 @@ FunctionType::Call(JSContext* cx,
       return false;
   }
 
+  // AutoValue is wider than a pointer, so build the array of argument
+  // pointers libffi expects separately.
+  Array<void*, 16> argPointers;
+  if (!argPointers.resize(values.length())) {
+    JS_ReportOutOfMemory(cx);
+    return false;
+  }
+  for (size_t i = 0; i < values.length(); ++i)
+    argPointers[i] = values[i].mData;
+
   // initialize a pointer to an appropriate location, for storing the result
   AutoValue returnValue;
   TypeCode typeCode = CType::GetTypeCode(fninfo->mReturnType);
@@ -5911,8 +5947,7 @@ FunctionType::Call(JSContext* cx,
   int savedErrno = errno;
   errno = 0;
 
-  ffi_call(&fninfo->mCIF, FFI_FN(fn), returnValue.mData,
-           reinterpret_cast<void**>(values.begin()));
+  ffi_call(&fninfo->mCIF, FFI_FN(fn), returnValue.mData, argPointers.begin());
 
   // Save error value.
   // We need to save it before leaving the scope of |suspend| as destructing
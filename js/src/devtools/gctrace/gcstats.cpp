@@ -796,6 +796,9 @@ processTraceFile(const char *filename)
           sweepNursery();
           state = StateMutator;
           break;
+      case TraceEventNurseryResize:
+          assert(state == StateMinorGC);
+          break;
       case TraceEventMajorGCStart:
           assert(state == StateMutator);
           state = StateMajorGC;
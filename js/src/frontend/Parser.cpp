@@ -495,6 +495,7 @@ Parser<ParseHandler>::Parser(ExclusiveContext *cx, LifoAlloc *alloc,
     foldConstants(foldConstants),
     abortedSyntaxParse(false),
     isUnexpectedEOF_(false),
+    parenthesizedFunction(false),
     sawDeprecatedForEach(false),
     sawDeprecatedDestructuringForIn(false),
     sawDeprecatedLegacyGenerator(false),
@@ -2018,6 +2019,9 @@ Parser<ParseHandler>::functionDef(HandlePropertyName funName,
     if (!checkFunctionDefinition(funName, &pn, kind, &bodyProcessed, &bodyLevelHoistedUse))
         return null();
 
+    bool parenthesized = parenthesizedFunction;
+    parenthesizedFunction = false;
+
     if (bodyProcessed)
         return pn;
 
@@ -2047,7 +2051,7 @@ Parser<ParseHandler>::functionDef(HandlePropertyName funName,
 
     while (true) {
         if (functionArgsAndBody(pn, fun, type, kind, generatorKind, directives, &newDirectives,
-                                bodyLevelHoistedUse))
+                                bodyLevelHoistedUse, parenthesized))
             break;
         if (tokenStream.hadError() || directives == newDirectives)
             return null();
@@ -2157,6 +2161,22 @@ Parser<SyntaxParseHandler>::finishFunctionDefinition(Node pn, FunctionBox *funbo
     return true;
 }
 
+/*
+ * Function expressions wrapped in parentheses are almost always invoked
+ * immediately: "(function () { ... })()" is the usual module pattern of
+ * concatenated bundles. If such a function were syntax parsed it would be
+ * reparsed and emitted on the main thread as soon as it is called. When we
+ * are already parsing off the main thread, do the full parse now instead so
+ * the compiled script is merged into the target compartment together with
+ * the rest of the off-thread results.
+ */
+template <typename ParseHandler>
+bool
+Parser<ParseHandler>::shouldCompileEagerly(bool parenthesized)
+{
+    return parenthesized && !context->isJSContext();
+}
+
 template <>
 bool
 Parser<FullParseHandler>::functionArgsAndBody(ParseNode *pn, HandleFunction fun,
@@ -2164,7 +2184,7 @@ Parser<FullParseHandler>::functionArgsAndBody(ParseNode *pn, HandleFunction fun,
                                               GeneratorKind generatorKind,
                                               Directives inheritedDirectives,
                                               Directives *newDirectives,
-                                              bool bodyLevelHoistedUse)
+                                              bool bodyLevelHoistedUse, bool parenthesized)
 {
     ParseContext<FullParseHandler> *outerpc = pc;
 
@@ -2176,7 +2196,7 @@ Parser<FullParseHandler>::functionArgsAndBody(ParseNode *pn, HandleFunction fun,
     // Try a syntax parse for this inner function.
     do {
         Parser<SyntaxParseHandler> *parser = handler.syntaxParser;
-        if (!parser)
+        if (!parser || shouldCompileEagerly(parenthesized))
             break;
 
         {
@@ -2256,7 +2276,7 @@ Parser<SyntaxParseHandler>::functionArgsAndBody(Node pn, HandleFunction fun,
                                                 GeneratorKind generatorKind,
                                                 Directives inheritedDirectives,
                                                 Directives *newDirectives,
-                                                bool bodyLevelHoistedUse)
+                                                bool bodyLevelHoistedUse, bool parenthesized)
 {
     ParseContext<SyntaxParseHandler> *outerpc = pc;
 
@@ -7729,6 +7749,9 @@ Parser<ParseHandler>::parenExprOrGeneratorComprehension()
     if (tokenStream.matchToken(TOK_FOR, TokenStream::Operand))
         return generatorComprehension(begin);
 
+    if (tokenStream.peekToken(TokenStream::Operand) == TOK_FUNCTION)
+        parenthesizedFunction = true;
+
     /*
      * Always accept the 'in' operator in a parenthesized expression,
      * where it's unambiguous, even if we might be parsing the init of a
@@ -367,6 +367,13 @@ class Parser : private JS::AutoGCRooter, public StrictModeGetter
     /* Unexpected end of input, i.e. TOK_EOF not at top-level. */
     bool isUnexpectedEOF_:1;
 
+    /*
+     * Set when the next token is a function expression directly following an
+     * open parenthesis, as in "(function () { ... })()". See
+     * shouldCompileEagerly.
+     */
+    bool parenthesizedFunction:1;
+
     /* Used for collecting telemetry on SpiderMonkey's deprecated language extensions. */
     bool sawDeprecatedForEach:1;
     bool sawDeprecatedDestructuringForIn:1;
@@ -575,7 +582,8 @@ class Parser : private JS::AutoGCRooter, public StrictModeGetter
                              FunctionType type, FunctionSyntaxKind kind,
                              GeneratorKind generatorKind,
                              Directives inheritedDirectives, Directives *newDirectives,
-                             bool bodyLevelHoistedUse);
+                             bool bodyLevelHoistedUse, bool parenthesized);
+    bool shouldCompileEagerly(bool parenthesized);
 
     Node unaryOpExpr(ParseNodeKind kind, JSOp op, uint32_t begin);
 
@@ -513,6 +513,28 @@ TokenStream::TokenBuf::findEOLMax(const char16_t *p, size_t max)
     return p;
 }
 
+void
+TokenStream::TokenBuf::skipAsciiIdentifierChars()
+{
+    MOZ_ASSERT(ptr);     // make sure it hasn't been poisoned
+
+    const char16_t *p = ptr;
+    while (p < limit_ && *p < 128 && js_isident[*p])
+        p++;
+    ptr = p;
+}
+
+void
+TokenStream::TokenBuf::skipAsciiSpaceChars()
+{
+    MOZ_ASSERT(ptr);     // make sure it hasn't been poisoned
+
+    const char16_t *p = ptr;
+    while (p < limit_ && (*p == ' ' || *p == '\t' || *p == '\v' || *p == '\f'))
+        p++;
+    ptr = p;
+}
+
 void
 TokenStream::advance(size_t position)
 {
@@ -1181,8 +1203,10 @@ TokenStream::getTokenInternal(Modifier modifier)
 
     // Skip over non-EOL whitespace chars.
     //
-    if (c1kind == Space)
+    if (c1kind == Space) {
+        userbuf.skipAsciiSpaceChars();
         goto retry;
+    }
 
     // Look for an identifier.
     //
@@ -1192,6 +1216,7 @@ TokenStream::getTokenInternal(Modifier modifier)
         hadUnicodeEscape = false;
 
       identifier:
+        userbuf.skipAsciiIdentifierChars();
         for (;;) {
             c = getCharIgnoreEOL();
             if (c == EOF)
@@ -697,6 +697,14 @@ class MOZ_STACK_CLASS TokenStream
         // (*including* the starting char16_t).
         const char16_t *findEOLMax(const char16_t *p, size_t max);
 
+        // Skip over a run of ASCII identifier or non-EOL whitespace chars.
+        // These runs make up most of the source text, so they're consumed
+        // with a bare pointer walk rather than a char at a time through
+        // getCharIgnoreEOL().  Neither ever skips past anything that needs
+        // special handling (EOLs, escapes, non-ASCII chars).
+        void skipAsciiIdentifierChars();
+        void skipAsciiSpaceChars();
+
       private:
         const char16_t *base_;          // base of buffer
         const char16_t *limit_;         // limit for quick bounds check
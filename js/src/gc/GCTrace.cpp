@@ -219,6 +219,12 @@ js::gc::TraceMinorGCEnd()
     TraceEvent(TraceEventMinorGCEnd);
 }
 
+void
+js::gc::TraceNurseryResize(size_t activeChunks)
+{
+    TraceEvent(TraceEventNurseryResize, activeChunks);
+}
+
 void
 js::gc::TraceMajorGCStart()
 {
@@ -26,6 +26,7 @@ extern void TraceCreateObject(JSObject* object);
 extern void TraceMinorGCStart();
 extern void TracePromoteToTenured(Cell *src, Cell *dst);
 extern void TraceMinorGCEnd();
+extern void TraceNurseryResize(size_t activeChunks);
 extern void TraceMajorGCStart();
 extern void TraceTenuredFinalize(Cell *thing);
 extern void TraceMajorGCEnd();
@@ -42,6 +43,7 @@ inline void TraceCreateObject(JSObject* object) {}
 inline void TraceMinorGCStart() {}
 inline void TracePromoteToTenured(Cell *src, Cell *dst) {}
 inline void TraceMinorGCEnd() {}
+inline void TraceNurseryResize(size_t activeChunks) {}
 inline void TraceMajorGCStart() {}
 inline void TraceTenuredFinalize(Cell *thing) {}
 inline void TraceMajorGCEnd() {}
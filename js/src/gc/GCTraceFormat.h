@@ -32,6 +32,7 @@ enum GCTraceEvent {
     TraceEventMajorGCStart,
     TraceEventTenuredFinalize,
     TraceEventMajorGCEnd,
+    TraceEventNurseryResize,
 
     TraceDataAddress,  // following TraceEventPromote
     TraceDataInt,      // following TraceEventClassInfo
@@ -40,7 +41,7 @@ enum GCTraceEvent {
     GCTraceEventCount
 };
 
-const unsigned TraceFormatVersion = 1;
+const unsigned TraceFormatVersion = 2;
 
 const unsigned TracePayloadBits = 48;
 
@@ -1745,6 +1745,8 @@ GCMarker::processMarkStackTop(SliceBudget &budget)
             return;
         }
 
+        scannedObjects++;
+
         types::TypeObject *type = obj->typeFromGC();
         PushMarkStack(this, type);
 
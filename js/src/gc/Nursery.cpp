@@ -47,6 +47,12 @@ using mozilla::PodZero;
 static int64_t GCReportThreshold = INT64_MAX;
 #endif
 
+/*
+ * Minor collections triggered by a full nursery less than this many
+ * microseconds apart cause the nursery to grow, whatever its promotion rate.
+ */
+static const int64_t FrequentCollectionIntervalUsec = 50 * PRMJ_USEC_PER_MSEC;
+
 bool
 js::Nursery::init(uint32_t maxNurseryBytes)
 {
@@ -68,6 +74,7 @@ js::Nursery::init(uint32_t maxNurseryBytes)
     heapEnd_ = heapStart_ + nurserySize();
     currentStart_ = start();
     numActiveChunks_ = 1;
+    maxActiveChunks_ = numNurseryChunks_;
     JS_POISON(heap, JS_FRESH_NURSERY_PATTERN, nurserySize());
     setCurrentChunk(0);
     updateDecommittedRegion();
@@ -106,6 +113,19 @@ js::Nursery::updateDecommittedRegion()
 #endif
 }
 
+void
+js::Nursery::setMaxActiveChunks(size_t maxChunks)
+{
+    if (!exists())
+        return;
+
+    /*
+     * The nursery may currently be using more chunks than this; it will be
+     * trimmed to the new limit after the next minor collection.
+     */
+    maxActiveChunks_ = Max(Min(int(maxChunks), numNurseryChunks_), 1);
+}
+
 void
 js::Nursery::enable()
 {
@@ -470,25 +490,44 @@ js::Nursery::forwardBufferPointer(HeapSlot **pSlotsElems)
     MOZ_ASSERT(IsWriteableAddress(*pSlotsElems));
 }
 
+// A type must have at least this many objects tenured in one minor collection
+// before we consider pretenuring it.
+static const int PretenureCountThreshold = 3000;
+
+// Pretenure a type whose tenured objects took up more than this fraction of
+// the nursery, even if the nursery as a whole was mostly garbage.
+static const double PretenureShareThreshold = 0.25;
+
 // Structure for counting how many times objects of a particular type have been
 // tenured during a minor collection.
 struct TenureCount
 {
     types::TypeObject *type;
     int count;
+    size_t bytes;
 };
 
 // Keep rough track of how many times we tenure objects of particular types
 // during minor collections, using a fixed size hash for efficiency at the cost
-// of potential collisions.
+// of potential collisions. A short linear probe keeps a hot type from being
+// hidden behind a colder one that happened to claim its slot first.
 struct Nursery::TenureCountCache
 {
-    TenureCount entries[16];
+    static const size_t EntryCount = 32;
+    static const size_t MaxProbes = 4;
+
+    TenureCount entries[EntryCount];
 
     TenureCountCache() { PodZero(this); }
 
-    TenureCount &findEntry(types::TypeObject *type) {
-        return entries[PointerHasher<types::TypeObject *, 3>::hash(type) % ArrayLength(entries)];
+    TenureCount *findEntry(types::TypeObject *type) {
+        size_t index = PointerHasher<types::TypeObject *, 3>::hash(type) % EntryCount;
+        for (size_t i = 0; i < MaxProbes; i++) {
+            TenureCount &entry = entries[(index + i) % EntryCount];
+            if (entry.type == type || !entry.type)
+                return &entry;
+        }
+        return nullptr;
     }
 };
 
@@ -499,12 +538,10 @@ js::Nursery::collectToFixedPoint(MinorCollectionTracer *trc, TenureCountCache &t
         JSObject *obj = static_cast<JSObject*>(p->forwardingAddress());
         traceObject(trc, obj);
 
-        TenureCount &entry = tenureCounts.findEntry(obj->type());
-        if (entry.type == obj->type()) {
-            entry.count++;
-        } else if (!entry.type) {
-            entry.type = obj->type();
-            entry.count = 1;
+        if (TenureCount *entry = tenureCounts.findEntry(obj->type())) {
+            entry->type = obj->type();
+            entry->count++;
+            entry->bytes += obj->tenuredSizeOfThis();
         }
     }
 }
@@ -755,6 +792,9 @@ js::Nursery::collect(JSRuntime *rt, JS::gcreason::Reason reason, TypeObjectList
 
     TraceMinorGCStart();
 
+    int64_t collectionStart = PRMJ_Now();
+    int64_t interval = lastCollectionEnd_ ? collectionStart - lastCollectionEnd_ : INT64_MAX;
+
     TIME_START(total);
 
     AutoStopVerifyingBarriers av(rt, false);
@@ -834,22 +874,30 @@ js::Nursery::collect(JSRuntime *rt, JS::gcreason::Reason reason, TypeObjectList
 
     // Resize the nursery.
     TIME_START(resize);
-    double promotionRate = trc.tenuredSize / double(allocationEnd() - start());
-    if (promotionRate > 0.05)
-        growAllocableSpace();
-    else if (promotionRate < 0.01)
-        shrinkAllocableSpace();
+    // Measure against the nursery that was collected, before resize() changes
+    // the number of active chunks.
+    size_t usedBytes = allocationEnd() - start();
+    double promotionRate = trc.tenuredSize / double(usedBytes);
+    resize(reason, promotionRate, interval);
     TIME_END(resize);
 
     // If we are promoting the nursery, or exhausted the store buffer with
     // pointers to nursery things, which will force a collection well before
     // the nursery is full, look for object types that are getting promoted
-    // excessively and try to pretenure them.
+    // excessively and try to pretenure them. Independently of the overall
+    // promotion rate, also pretenure any single type whose survivors alone
+    // filled a large share of the nursery: that allocation site is paying
+    // most of the copying cost of every minor GC.
     TIME_START(pretenure);
-    if (pretenureTypes && (promotionRate > 0.8 || reason == JS::gcreason::FULL_STORE_BUFFER)) {
+    if (pretenureTypes) {
+        bool promotingNursery =
+            promotionRate > 0.8 || reason == JS::gcreason::FULL_STORE_BUFFER;
         for (size_t i = 0; i < ArrayLength(tenureCounts.entries); i++) {
             const TenureCount &entry = tenureCounts.entries[i];
-            if (entry.count >= 3000)
+            if (entry.count < PretenureCountThreshold)
+                continue;
+            double share = entry.bytes / double(usedBytes);
+            if (promotingNursery || share > PretenureShareThreshold)
                 pretenureTypes->append(entry.type); // ignore alloc failure
         }
     }
@@ -876,6 +924,8 @@ js::Nursery::collect(JSRuntime *rt, JS::gcreason::Reason reason, TypeObjectList
 
     TIME_END(total);
 
+    lastCollectionEnd_ = PRMJ_Now();
+
     TraceMinorGCEnd();
 
 #ifdef PROFILE_NURSERY
@@ -970,7 +1020,7 @@ js::Nursery::growAllocableSpace()
     MOZ_ASSERT_IF(runtime()->gcZeal() == ZealGenerationalGCValue,
                   numActiveChunks_ == numNurseryChunks_);
 #endif
-    numActiveChunks_ = Min(numActiveChunks_ * 2, numNurseryChunks_);
+    numActiveChunks_ = Min(numActiveChunks_ * 2, maxActiveChunks_);
 }
 
 void
@@ -984,4 +1034,37 @@ js::Nursery::shrinkAllocableSpace()
     updateDecommittedRegion();
 }
 
+/*
+ * A high promotion rate means the nursery is too small for objects to die
+ * before they are collected, so grow it. A nursery that keeps filling up in
+ * quick succession is also grown, even if little of it survives, to amortize
+ * the fixed cost of marking roots and the store buffer on every collection.
+ * If almost nothing survives and collections are infrequent, shrink it to
+ * give the memory back.
+ */
+void
+js::Nursery::resize(JS::gcreason::Reason reason, double promotionRate, int64_t interval)
+{
+#ifdef JS_GC_ZEAL
+    if (runtime()->gcZeal() == ZealGenerationalGCValue)
+        return;
+#endif
+
+    int oldActiveChunks = numActiveChunks_;
+    bool frequent = reason == JS::gcreason::OUT_OF_NURSERY &&
+                    interval < FrequentCollectionIntervalUsec;
+    if (promotionRate > 0.05 || frequent)
+        growAllocableSpace();
+    else if (promotionRate < 0.01)
+        shrinkAllocableSpace();
+
+    if (numActiveChunks_ > maxActiveChunks_) {
+        numActiveChunks_ = maxActiveChunks_;
+        updateDecommittedRegion();
+    }
+
+    if (numActiveChunks_ != oldActiveChunks)
+        TraceNurseryResize(numActiveChunks_);
+}
+
 #endif /* JSGC_GENERATIONAL */
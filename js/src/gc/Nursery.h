@@ -66,7 +66,9 @@ class Nursery
         heapEnd_(0),
         currentChunk_(0),
         numActiveChunks_(0),
-        numNurseryChunks_(0)
+        numNurseryChunks_(0),
+        maxActiveChunks_(0),
+        lastCollectionEnd_(0)
     {}
     ~Nursery();
 
@@ -76,6 +78,14 @@ class Nursery
     size_t numChunks() const { return numNurseryChunks_; }
     size_t nurserySize() const { return numNurseryChunks_ << ChunkShift; }
 
+    /*
+     * The nursery grows and shrinks between one chunk and this many chunks
+     * depending on its promotion rate and how often it fills up. This is
+     * never more than the number of chunks reserved at startup.
+     */
+    size_t maxActiveChunks() const { return maxActiveChunks_; }
+    void setMaxActiveChunks(size_t maxChunks);
+
     void enable();
     void disable();
     bool isEnabled() const { return numActiveChunks_ != 0; }
@@ -197,6 +207,12 @@ class Nursery
     /* Number of chunks allocated for the nursery. */
     int numNurseryChunks_;
 
+    /* Upper bound on numActiveChunks_ set through JSGC_MAX_NURSERY_BYTES. */
+    int maxActiveChunks_;
+
+    /* Time at which the previous minor collection finished. */
+    int64_t lastCollectionEnd_;
+
     /*
      * The set of externally malloced slots potentially kept live by objects
      * stored in the nursery. Any external slots that do not belong to a
@@ -306,6 +322,7 @@ class Nursery
     /* Change the allocable space provided by the nursery. */
     void growAllocableSpace();
     void shrinkAllocableSpace();
+    void resize(JS::gcreason::Reason reason, double promotionRate, int64_t interval);
 
     static void MinorGCCallback(JSTracer *trc, void **thingp, JSGCTraceKind kind);
 
@@ -341,6 +341,15 @@ Statistics::gcDuration(int64_t *total, int64_t *maxPause)
         maxPauseInInterval = *maxPause;
 }
 
+uint64_t
+Statistics::objectsMarked() const
+{
+    uint64_t total = 0;
+    for (const SliceData *slice = slices.begin(); slice != slices.end(); slice++)
+        total += slice->objectsMarked();
+    return total;
+}
+
 void
 Statistics::sccDurations(int64_t *total, int64_t *maxPause)
 {
@@ -386,6 +395,9 @@ Statistics::formatData(StatisticsSerializer &ss, uint64_t timestamp)
     ss.appendNumber("Allocated", "%u", "MB", unsigned(preBytes / 1024 / 1024));
     ss.appendNumber("+Chunks", "%d", "", counts[STAT_NEW_CHUNK]);
     ss.appendNumber("-Chunks", "%d", "", counts[STAT_DESTROY_CHUNK]);
+    ss.appendNumber("Objects Marked", "%llu", "", (unsigned long long)objectsMarked());
+    ss.appendNumber("Compacted", "%u", "KB",
+                    unsigned(counts[STAT_ARENA_RELOCATED] * gc::ArenaSize / 1024));
     ss.endLine();
 
     if (slices.length() > 1 || ss.isJSON()) {
@@ -408,6 +420,8 @@ Statistics::formatData(StatisticsSerializer &ss, uint64_t timestamp)
             if (ss.isJSON()) {
                 ss.appendDecimal("Page Faults", "",
                                  double(slices[i].endFaults - slices[i].startFaults));
+                ss.appendNumber("Objects Marked", "%llu", "",
+                                (unsigned long long)slices[i].objectsMarked());
 
                 ss.appendNumber("Start Timestamp", "%llu", "", (unsigned long long)slices[i].start);
                 ss.appendNumber("End Timestamp", "%llu", "", (unsigned long long)slices[i].end);
@@ -469,6 +483,8 @@ Statistics::formatDescription()
   SCC Sweep Total (MaxPause): %.3fms (%.3fms)\n\
   HeapSize: %.3f MiB\n\
   Chunk Delta (magnitude): %+d  (%d)\n\
+  Objects Marked: %llu\n\
+  Arenas Relocated: %d  (%.3f MiB)\n\
 ";
     char buffer[1024];
     memset(buffer, 0, sizeof(buffer));
@@ -483,7 +499,10 @@ Statistics::formatDescription()
                 t(sccTotal), t(sccLongest),
                 double(preBytes) / 1024. / 1024.,
                 counts[STAT_NEW_CHUNK] - counts[STAT_DESTROY_CHUNK], counts[STAT_NEW_CHUNK] +
-                                                                  counts[STAT_DESTROY_CHUNK]);
+                                                                  counts[STAT_DESTROY_CHUNK],
+                (unsigned long long)objectsMarked(),
+                counts[STAT_ARENA_RELOCATED],
+                double(counts[STAT_ARENA_RELOCATED] * gc::ArenaSize) / 1024. / 1024.);
     return make_string_copy(buffer);
 }
 
@@ -497,6 +516,7 @@ Statistics::formatSliceDescription(unsigned i, const SliceData &slice)
     Reset: %s%s\n\
     Page Faults: %ld\n\
     Pause: %.3fms  (@ %.3fms)\n\
+    Objects Marked: %llu\n\
 ";
     char buffer[1024];
     memset(buffer, 0, sizeof(buffer));
@@ -504,7 +524,8 @@ Statistics::formatSliceDescription(unsigned i, const SliceData &slice)
                 ExplainReason(slice.reason),
                 slice.resetReason ? "yes - " : "no", slice.resetReason ? slice.resetReason : "",
                 uint64_t(slice.endFaults - slice.startFaults),
-                t(slice.duration()), t(slice.start - slices[0].start));
+                t(slice.duration()), t(slice.start - slices[0].start),
+                (unsigned long long)slice.objectsMarked());
     return make_string_copy(buffer);
 }
 
@@ -765,7 +786,8 @@ Statistics::beginSlice(const ZoneGCStats &zoneStats, JS::gcreason::Reason reason
     if (first)
         beginGC();
 
-    SliceData data(reason, PRMJ_Now(), GetPageFaultCount());
+    SliceData data(reason, PRMJ_Now(), GetPageFaultCount(),
+                   runtime->gc.marker.scannedObjectCount());
     (void) slices.append(data); /* Ignore any OOMs here. */
 
     if (JSAccumulateTelemetryDataCallback cb = runtime->telemetryCallback)
@@ -785,6 +807,7 @@ Statistics::endSlice()
 {
     slices.back().end = PRMJ_Now();
     slices.back().endFaults = GetPageFaultCount();
+    slices.back().endMarked = runtime->gc.marker.scannedObjectCount();
 
     if (JSAccumulateTelemetryDataCallback cb = runtime->telemetryCallback) {
         (*cb)(JS_TELEMETRY_GC_SLICE_MS, t(slices.back().end - slices.back().start));
@@ -76,6 +76,9 @@ enum Stat {
     STAT_DESTROY_CHUNK,
     STAT_MINOR_GC,
 
+    // Number of arenas emptied and released by compacting GC.
+    STAT_ARENA_RELOCATED,
+
     STAT_LIMIT
 };
 
@@ -152,8 +155,10 @@ struct Statistics
     const char *nonincrementalReason;
 
     struct SliceData {
-        SliceData(JS::gcreason::Reason reason, int64_t start, size_t startFaults)
-          : reason(reason), resetReason(nullptr), start(start), startFaults(startFaults)
+        SliceData(JS::gcreason::Reason reason, int64_t start, size_t startFaults,
+                  uint64_t startMarked)
+          : reason(reason), resetReason(nullptr), start(start), startFaults(startFaults),
+            startMarked(startMarked), endMarked(startMarked)
         {
             mozilla::PodArrayZero(phaseTimes);
         }
@@ -162,9 +167,11 @@ struct Statistics
         const char *resetReason;
         int64_t start, end;
         size_t startFaults, endFaults;
+        uint64_t startMarked, endMarked;
         int64_t phaseTimes[PHASE_LIMIT];
 
         int64_t duration() const { return end - start; }
+        uint64_t objectsMarked() const { return endMarked - startMarked; }
     };
 
     Vector<SliceData, 8, SystemAllocPolicy> slices;
@@ -203,6 +210,7 @@ struct Statistics
     void endGC();
 
     void gcDuration(int64_t *total, int64_t *maxPause);
+    uint64_t objectsMarked() const;
     void sccDurations(int64_t *total, int64_t *maxPause);
     void printStats();
     bool formatData(StatisticsSerializer &ss, uint64_t timestamp);
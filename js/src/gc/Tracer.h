@@ -188,6 +188,13 @@ class GCMarker : public JSTracer
 
     bool drainMarkStack(SliceBudget &budget);
 
+    /*
+     * Monotonic count of objects scanned by this marker. Statistics samples
+     * this at slice boundaries to report how much marking work each slice
+     * performed, independent of how long it took.
+     */
+    uint64_t scannedObjectCount() const { return scannedObjects; }
+
     /*
      * Gray marking must be done after all black marking is complete. However,
      * we do not have write barriers on XPConnect roots. Therefore, XPConnect
@@ -280,6 +287,9 @@ class GCMarker : public JSTracer
     /* The color is only applied to objects and functions. */
     uint32_t color;
 
+    /* Number of objects scanned in processMarkStackTop; never reset. */
+    uint64_t scannedObjects;
+
     /* Pointer to the top of the stack of arenas we are delaying marking on. */
     js::gc::ArenaHeader *unmarkedArenaStackTop;
 
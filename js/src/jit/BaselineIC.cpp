@@ -6511,7 +6511,7 @@ TryAttachNativeDoesNotExistStub(JSContext *cx, HandleScript script, jsbytecode *
 
 static bool
 ComputeGetPropResult(JSContext *cx, BaselineFrame *frame, JSOp op, HandlePropertyName name,
-                     MutableHandleValue val, MutableHandleValue res)
+                     MutableHandleValue val, MutableHandleValue res, bool megamorphic = false)
 {
     // Handle arguments.length and arguments.callee on optimized arguments, as
     // it is not an object.
@@ -6530,8 +6530,13 @@ ComputeGetPropResult(JSContext *cx, BaselineFrame *frame, JSOp op, HandlePropert
             return false;
 
         RootedId id(cx, NameToId(name));
-        if (!JSObject::getGeneric(cx, obj, obj, id, res))
-            return false;
+        if (megamorphic) {
+            if (!GetPropertyMegamorphic(cx, obj, name, res))
+                return false;
+        } else {
+            if (!JSObject::getGeneric(cx, obj, obj, id, res))
+                return false;
+        }
 
 #if JS_HAS_NO_SUCH_METHOD
         // Handle objects with __noSuchMethod__.
@@ -7451,7 +7456,7 @@ DoGetPropGeneric(JSContext *cx, BaselineFrame *frame, ICGetProp_Generic *stub, M
     jsbytecode *pc = stub->getChainFallback()->icEntry()->pc(frame->script());
     JSOp op = JSOp(*pc);
     RootedPropertyName name(cx, frame->script()->getName(pc));
-    return ComputeGetPropResult(cx, frame, op, name, val, res);
+    return ComputeGetPropResult(cx, frame, op, name, val, res, /* megamorphic = */ true);
 }
 
 typedef bool (*DoGetPropGenericFn)(JSContext *, BaselineFrame *, ICGetProp_Generic *, MutableHandleValue, MutableHandleValue);
@@ -7421,6 +7421,11 @@ CodeGenerator::generate()
     // Dump Native to bytecode entries to spew.
     dumpNativeToBytecodeEntries();
 
+    // Encode safepoints now that the OSI-point offsets have been determined.
+    // This is done here rather than in link() so that off thread compilations
+    // do this work on the helper thread instead of the main thread.
+    encodeSafepoints();
+
     return !masm.oom();
 }
 
@@ -7486,9 +7491,6 @@ CodeGenerator::link(JSContext *cx, types::CompilerConstraintList *constraints)
                            ? frameDepth_
                            : FrameSizeClass::FromDepth(frameDepth_).frameSize();
 
-    // We encode safepoints after the OSI-point offsets have been determined.
-    encodeSafepoints();
-
     // List of possible scripts that this graph may call. Currently this is
     // only tracked when compiling for parallel execution.
     CallTargetVector callTargets(alloc());
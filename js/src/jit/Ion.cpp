@@ -11,6 +11,7 @@
 
 #include "jscompartment.h"
 #include "jsprf.h"
+#include "prmjtime.h"
 
 #include "asmjs/AsmJSModule.h"
 #include "gc/Marking.h"
@@ -1874,6 +1875,15 @@ AttachFinishedCompilations(JSContext *cx)
         if (!builder)
             break;
 
+        // Report how long the compilation waited for a helper thread.
+        if (builder->startTime()) {
+            if (JSAccumulateTelemetryDataCallback cb = cx->runtime()->telemetryCallback) {
+                int64_t waitTime = builder->startTime() - builder->enqueueTime();
+                (*cb)(JS_TELEMETRY_ION_COMPILE_QUEUE_WAIT_MS,
+                      uint32_t(waitTime / PRMJ_USEC_PER_MSEC));
+            }
+        }
+
 // TODO bug 1047346: Enable lazy linking for other architectures again by
 //                   fixing the lazy link stub.
 #if defined(JS_CODEGEN_X86) || defined(JS_CODEGEN_X64)
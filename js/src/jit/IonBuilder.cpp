@@ -116,6 +116,8 @@ IonBuilder::IonBuilder(JSContext *analysisContext, CompileCompartment *comp,
                        uint32_t loopDepth)
   : MIRGenerator(comp, options, temp, graph, info, optimizationInfo),
     backgroundCodegen_(nullptr),
+    enqueueTime_(0),
+    startTime_(0),
     analysisContext(analysisContext),
     baselineFrame_(baselineFrame),
     constraints_(constraints),
@@ -4457,6 +4459,64 @@ IonBuilder::makeInliningDecision(JSFunction *target, CallInfo &callInfo)
     return InliningDecision_Inline;
 }
 
+// Call sites with up to this many targets consider inlining all of them.
+static const uint32_t MaxPolyInlineTargets = 4;
+
+// Call sites with more targets (up to MaxPolyCallTargets) only inline the
+// MaxPolyInlineTargets hottest ones, and only when those account for at least
+// SkewedPolyCallShare of the targets' combined warm-up counts. The remaining
+// targets go through the generic fallback call.
+static const uint32_t MaxPolyCallTargets = 16;
+static const double SkewedPolyCallShare = 0.95;
+
+static uint32_t
+CallTargetWeight(JSObject *target)
+{
+    JSFunction *fun = &target->as<JSFunction>();
+    if (!fun->hasScript())
+        return 0;
+    return fun->nonLazyScript()->getWarmUpCount();
+}
+
+// Mark in |hot| the targets of a megamorphic call site which are worth
+// inlining. All are left unmarked, and false returned, if the call weight
+// isn't skewed enough.
+static bool
+SelectHotCallTargets(ObjectVector &targets, BoolVector &hot)
+{
+    MOZ_ASSERT(targets.length() > MaxPolyInlineTargets);
+    MOZ_ASSERT(hot.length() == targets.length());
+
+    uint64_t totalWeight = 0;
+    for (size_t i = 0; i < targets.length(); i++)
+        totalWeight += CallTargetWeight(targets[i]);
+    if (totalWeight == 0)
+        return false;
+
+    uint64_t hotWeight = 0;
+    for (uint32_t n = 0; n < MaxPolyInlineTargets; n++) {
+        size_t best = targets.length();
+        for (size_t i = 0; i < targets.length(); i++) {
+            if (hot[i])
+                continue;
+            if (best == targets.length() ||
+                CallTargetWeight(targets[i]) > CallTargetWeight(targets[best]))
+            {
+                best = i;
+            }
+        }
+        hot[best] = true;
+        hotWeight += CallTargetWeight(targets[best]);
+    }
+
+    if (double(hotWeight) < double(totalWeight) * SkewedPolyCallShare) {
+        for (size_t i = 0; i < hot.length(); i++)
+            hot[i] = false;
+        return false;
+    }
+    return true;
+}
+
 bool
 IonBuilder::selectInliningTargets(ObjectVector &targets, CallInfo &callInfo, BoolVector &choiceSet,
                                   uint32_t *numInlineable)
@@ -4473,8 +4533,26 @@ IonBuilder::selectInliningTargets(ObjectVector &targets, CallInfo &callInfo, Boo
     if (info().executionMode() == DefinitePropertiesAnalysis && targets.length() > 1)
         return true;
 
+    // For megamorphic sites, restrict inlining to the few hot targets.
+    BoolVector hot(alloc());
+    if (targets.length() > MaxPolyInlineTargets) {
+        if (!hot.appendN(false, targets.length()))
+            return false;
+        bool skewed = SelectHotCallTargets(targets, hot);
+        JitSpew(JitSpew_Inlining, "Megamorphic call site with %u targets is %s",
+                unsigned(targets.length()), skewed ? "skewed" : "not skewed");
+        if (!skewed)
+            return true;
+    }
+
     for (size_t i = 0; i < targets.length(); i++) {
         JSFunction *target = &targets[i]->as<JSFunction>();
+
+        if (!hot.empty() && !hot[i]) {
+            choiceSet.append(false);
+            continue;
+        }
+
         bool inlineable;
         InliningDecision decision = makeInliningDecision(target, callInfo);
         switch (decision) {
@@ -5443,8 +5521,11 @@ IonBuilder::jsop_call(uint32_t argc, bool constructing)
     bool gotLambda = false;
     types::TemporaryTypeSet *calleeTypes = current->peek(calleeDepth)->resultTypeSet();
     if (calleeTypes) {
-        if (!getPolyCallTargets(calleeTypes, constructing, originals, 4, &gotLambda))
+        if (!getPolyCallTargets(calleeTypes, constructing, originals, MaxPolyCallTargets,
+                                &gotLambda))
+        {
             return false;
+        }
     }
     MOZ_ASSERT_IF(gotLambda, originals.length() <= 1);
 
@@ -10200,7 +10281,9 @@ IonBuilder::jsop_lambda(JSFunction *fun)
     if (fun->isNative() && IsAsmJSModuleNative(fun->native()))
         return abort("asm.js module function");
 
-    MLambda *ins = MLambda::New(alloc(), constraints(), current->scopeChain(), fun);
+    MConstant *cst = MConstant::NewConstraintlessObject(alloc(), fun);
+    current->add(cst);
+    MLambda *ins = MLambda::New(alloc(), constraints(), current->scopeChain(), cst);
     current->add(ins);
     current->push(ins);
 
@@ -10216,8 +10299,10 @@ IonBuilder::jsop_lambda_arrow(JSFunction *fun)
 
     MDefinition *thisDef = current->pop();
 
+    MConstant *cst = MConstant::NewConstraintlessObject(alloc(), fun);
+    current->add(cst);
     MLambdaArrow *ins = MLambdaArrow::New(alloc(), constraints(), current->scopeChain(),
-                                          thisDef, fun);
+                                          thisDef, cst);
     current->add(ins);
     current->push(ins);
 
@@ -849,6 +849,13 @@ class IonBuilder
     // performed by FinishOffThreadBuilder().
     CodeGenerator *backgroundCodegen_;
 
+    // For off thread compilations, the times (in microseconds) at which the
+    // builder was added to the helper thread worklist and at which a helper
+    // thread started compiling it. The latter is zero if the compilation was
+    // cancelled or skipped before it started.
+    int64_t enqueueTime_;
+    int64_t startTime_;
+
   public:
     void clearForBackEnd();
 
@@ -857,6 +864,11 @@ class IonBuilder
     CodeGenerator *backgroundCodegen() const { return backgroundCodegen_; }
     void setBackgroundCodegen(CodeGenerator *codegen) { backgroundCodegen_ = codegen; }
 
+    int64_t enqueueTime() const { return enqueueTime_; }
+    void setEnqueueTime(int64_t time) { enqueueTime_ = time; }
+    int64_t startTime() const { return startTime_; }
+    void setStartTime(int64_t time) { startTime_ = time; }
+
     types::CompilerConstraintList *constraints() {
         return constraints_;
     }
@@ -1757,8 +1757,13 @@ GetPropertyIC::update(JSContext *cx, size_t cacheIndex,
     }
 
     RootedId id(cx, NameToId(name));
-    if (!JSObject::getGeneric(cx, obj, obj, id, vp))
-        return false;
+    if (cache.canAttachStub()) {
+        if (!JSObject::getGeneric(cx, obj, obj, id, vp))
+            return false;
+    } else {
+        if (!GetPropertyMegamorphic(cx, obj, name, vp))
+            return false;
+    }
 
     if (!cache.idempotent()) {
         RootedScript script(cx);
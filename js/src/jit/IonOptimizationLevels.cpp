@@ -42,6 +42,7 @@ OptimizationInfo::initNormalOptimizationInfo()
     smallFunctionMaxInlineDepth_ = 10;
     compilerWarmUpThreshold_ = 1000;
     inliningWarmUpThresholdFactor_ = 0.125;
+    selfHostedWarmUpThresholdFactor_ = 0.25;
 }
 
 void
@@ -72,6 +73,8 @@ OptimizationInfo::compilerWarmUpThreshold(JSScript *script, jsbytecode *pc) cons
     uint32_t warmUpThreshold = compilerWarmUpThreshold_;
     if (js_JitOptions.forceDefaultIonWarmUpThreshold)
         warmUpThreshold = js_JitOptions.forcedDefaultIonWarmUpThreshold;
+    else if (script->selfHosted())
+        warmUpThreshold *= selfHostedWarmUpThresholdFactor_;
 
     // If the script is too large to compile on the main thread, we can still
     // compile it off thread. In these cases, increase the warm-up counter
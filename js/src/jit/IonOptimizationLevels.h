@@ -108,6 +108,10 @@ class OptimizationInfo
     // are inlined, as a fraction of compilerWarmUpThreshold.
     double inliningWarmUpThresholdFactor_;
 
+    // How many invocations or loop iterations are needed before self-hosted
+    // functions are compiled, as a fraction of compilerWarmUpThreshold.
+    double selfHostedWarmUpThresholdFactor_;
+
     OptimizationInfo()
     { }
 
@@ -250,6 +250,7 @@ jit::CheckLogging()
             "  safepoints Safepoints\n"
             "  pools      Literal Pools (ARM only for now)\n"
             "  cacheflush Instruction Cache flushes (ARM only for now)\n"
+            "  megamorphic Megamorphic property cache statistics\n"
             "  range      Range Analysis\n"
             "  unroll     Loop unrolling\n"
             "  logs       C1 and JSON visualization logging\n"
@@ -308,6 +309,8 @@ jit::CheckLogging()
         EnableChannel(JitSpew_Pools);
     if (ContainsFlag(env, "cacheflush"))
         EnableChannel(JitSpew_CacheFlush);
+    if (ContainsFlag(env, "megamorphic"))
+        EnableChannel(JitSpew_MegamorphicCache);
     if (ContainsFlag(env, "logs"))
         EnableIonDebugLogging();
     if (ContainsFlag(env, "profiling"))
@@ -46,6 +46,8 @@ namespace jit {
     _(Profiling)                            \
     /* Debug info about the I$ */           \
     _(CacheFlush)                           \
+    /* Megamorphic property cache stats */  \
+    _(MegamorphicCache)                     \
                                             \
     /* BASELINE COMPILER SPEW */            \
                                             \
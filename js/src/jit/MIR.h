@@ -6588,56 +6588,68 @@ struct LambdaFunctionInfo
 };
 
 class MLambda
-  : public MUnaryInstruction,
+  : public MBinaryInstruction,
     public SingleObjectPolicy::Data
 {
     LambdaFunctionInfo info_;
 
-    MLambda(types::CompilerConstraintList *constraints, MDefinition *scopeChain, JSFunction *fun)
-      : MUnaryInstruction(scopeChain), info_(fun)
+    MLambda(types::CompilerConstraintList *constraints, MDefinition *scopeChain, MConstant *cst)
+      : MBinaryInstruction(scopeChain, cst), info_(&cst->value().toObject().as<JSFunction>())
     {
         setResultType(MIRType_Object);
-        if (!fun->hasSingletonType() && !types::UseNewTypeForClone(fun))
-            setResultTypeSet(MakeSingletonTypeSet(constraints, fun));
+        if (!info().fun->hasSingletonType() && !types::UseNewTypeForClone(info().fun))
+            setResultTypeSet(MakeSingletonTypeSet(constraints, info().fun));
     }
 
   public:
     INSTRUCTION_HEADER(Lambda)
 
     static MLambda *New(TempAllocator &alloc, types::CompilerConstraintList *constraints,
-                        MDefinition *scopeChain, JSFunction *fun)
+                        MDefinition *scopeChain, MConstant *fun)
     {
         return new(alloc) MLambda(constraints, scopeChain, fun);
     }
     MDefinition *scopeChain() const {
         return getOperand(0);
     }
+    MConstant *functionOperand() const {
+        return getOperand(1)->toConstant();
+    }
     const LambdaFunctionInfo &info() const {
         return info_;
     }
+
+    bool writeRecoverData(CompactBufferWriter &writer) const;
+    bool canRecoverOnBailout() const {
+        // A closure which is only captured by resume points, such as one
+        // whose calls have all been inlined, can be allocated on bailout.
+        // Singleton functions are only cloned once, so don't bother.
+        return !info_.singletonType && !info_.useNewTypeForClone;
+    }
 };
 
 class MLambdaArrow
-  : public MBinaryInstruction,
+  : public MTernaryInstruction,
     public MixPolicy<ObjectPolicy<0>, BoxPolicy<1> >::Data
 {
     LambdaFunctionInfo info_;
 
     MLambdaArrow(types::CompilerConstraintList *constraints, MDefinition *scopeChain,
-                 MDefinition *this_, JSFunction *fun)
-      : MBinaryInstruction(scopeChain, this_), info_(fun)
+                 MDefinition *this_, MConstant *cst)
+      : MTernaryInstruction(scopeChain, this_, cst),
+        info_(&cst->value().toObject().as<JSFunction>())
     {
         setResultType(MIRType_Object);
-        MOZ_ASSERT(!types::UseNewTypeForClone(fun));
-        if (!fun->hasSingletonType())
-            setResultTypeSet(MakeSingletonTypeSet(constraints, fun));
+        MOZ_ASSERT(!types::UseNewTypeForClone(info().fun));
+        if (!info().fun->hasSingletonType())
+            setResultTypeSet(MakeSingletonTypeSet(constraints, info().fun));
     }
 
   public:
     INSTRUCTION_HEADER(LambdaArrow)
 
     static MLambdaArrow *New(TempAllocator &alloc, types::CompilerConstraintList *constraints,
-                             MDefinition *scopeChain, MDefinition *this_, JSFunction *fun)
+                             MDefinition *scopeChain, MDefinition *this_, MConstant *fun)
     {
         return new(alloc) MLambdaArrow(constraints, scopeChain, this_, fun);
     }
@@ -6647,9 +6659,17 @@ class MLambdaArrow
     MDefinition *thisDef() const {
         return getOperand(1);
     }
+    MConstant *functionOperand() const {
+        return getOperand(2)->toConstant();
+    }
     const LambdaFunctionInfo &info() const {
         return info_;
     }
+
+    bool writeRecoverData(CompactBufferWriter &writer) const;
+    bool canRecoverOnBailout() const {
+        return !info_.singletonType;
+    }
 };
 
 class MLambdaPar
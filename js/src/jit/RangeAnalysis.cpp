@@ -1633,7 +1633,10 @@ RangeAnalysis::analyzeLoop(MBasicBlock *header)
         return true;
     }
 
-    if (!loopIterationBounds.append(iterationBound))
+    // Loop unrolling needs to know the exact number of remaining iterations,
+    // which is only available when the tested phi has a unit stride. Other
+    // bounds are still good enough for hoisting bounds checks.
+    if (iterationBound->hasUnitStride() && !loopIterationBounds.append(iterationBound))
         return false;
 
 #ifdef DEBUG
@@ -1760,14 +1763,18 @@ RangeAnalysis::analyzeLoopIterationCount(MBasicBlock *header,
 
     LinearSum iterationBound(alloc());
     LinearSum currentIteration(alloc());
+    LinearSum testLimit(alloc());
 
-    if (lhsModified.constant == 1 && !lessEqual) {
+    if (lhsModified.constant >= 1 && !lessEqual) {
         // The value of lhs is 'initial(lhs) + iterCount' and this will end
         // execution of the loop if 'lhs + lhsN >= rhs'. Thus, an upper bound
         // on the number of backedges executed is:
         //
         // initial(lhs) + iterCount + lhsN == rhs
         // iterCount == rhsN - initial(lhs) - lhsN
+        //
+        // This is still an upper bound when lhs increases by more than one
+        // on each iteration, if not a precise one.
 
         if (rhs) {
             if (!iterationBound.add(rhs, 1))
@@ -1786,7 +1793,18 @@ RangeAnalysis::analyzeLoopIterationCount(MBasicBlock *header,
             return nullptr;
         if (!currentIteration.add(lhsInitial, -1))
             return nullptr;
-    } else if (lhsModified.constant == -1 && lessEqual) {
+
+        // Wherever the test has not exited the loop, 'lhs + lhsN < rhs':
+        //
+        // lhs <= rhs - lhsN - 1
+
+        if (rhs) {
+            if (!testLimit.add(rhs, 1))
+                return nullptr;
+        }
+        if (!testLimit.add(lhsConstant) || !testLimit.add(-1))
+            return nullptr;
+    } else if (lhsModified.constant <= -1 && lessEqual) {
         // The value of lhs is 'initial(lhs) - iterCount'. Similar to the above
         // case, an upper bound on the number of backedges executed is:
         //
@@ -1806,11 +1824,26 @@ RangeAnalysis::analyzeLoopIterationCount(MBasicBlock *header,
             return nullptr;
         if (!currentIteration.add(lhs.term, -1))
             return nullptr;
+
+        // Wherever the test has not exited the loop, 'lhs + lhsN > rhs':
+        //
+        // lhs >= rhs - lhsN + 1
+
+        if (rhs) {
+            if (!testLimit.add(rhs, 1))
+                return nullptr;
+        }
+        int32_t lhsConstant;
+        if (!SafeSub(0, lhs.constant, &lhsConstant))
+            return nullptr;
+        if (!testLimit.add(lhsConstant) || !testLimit.add(1))
+            return nullptr;
     } else {
         return nullptr;
     }
 
-    return new(alloc()) LoopIterationBound(header, test, iterationBound, currentIteration);
+    return new(alloc()) LoopIterationBound(header, test, iterationBound, currentIteration,
+                                           lhs.term->toPhi(), lhsModified.constant, testLimit);
 }
 
 void
@@ -1856,14 +1889,27 @@ RangeAnalysis::analyzeLoopPhi(MBasicBlock *header, LoopIterationBound *loopBound
     // at most loopBound - 1 times. Thus, another upper or lower bound for the
     // phi is initial(phi) + (loopBound - 1) * N, without requiring us to
     // ensure that loopBound >= 0.
+    //
+    // For the phi compared by the loop test, the test itself provides a bound
+    // at these points which is equivalent for unit strides, and tighter when
+    // the phi changes by more than one each iteration (e.g. 'i += 4' loops
+    // accessing a[i] through a[i + 3]).
 
-    LinearSum limitSum(loopBound->boundSum);
-    if (!limitSum.multiply(modified.constant) || !limitSum.add(initialSum))
-        return;
+    bool isTestPhi = phi == loopBound->testPhi;
+    MOZ_ASSERT_IF(isTestPhi, modified.constant == loopBound->stride);
 
-    int32_t negativeConstant;
-    if (!SafeSub(0, modified.constant, &negativeConstant) || !limitSum.add(negativeConstant))
-        return;
+    LinearSum limitSum(isTestPhi ? loopBound->testLimitSum : loopBound->boundSum);
+    if (!isTestPhi) {
+        if (!limitSum.multiply(modified.constant) || !limitSum.add(initialSum))
+            return;
+
+        int32_t negativeConstant;
+        if (!SafeSub(0, modified.constant, &negativeConstant) ||
+            !limitSum.add(negativeConstant))
+        {
+            return;
+        }
+    }
 
     Range *initRange = initial->range();
     if (modified.constant > 0) {
@@ -47,11 +47,25 @@ struct LoopIterationBound : public TempObject
     // of the loop header. This will use loop invariant terms and header phis.
     LinearSum currentSum;
 
-    LoopIterationBound(MBasicBlock *header, MTest *test, LinearSum boundSum, LinearSum currentSum)
+    // Header phi compared by the test, the amount it changes by on each
+    // iteration, and a bound on its value at points the test dominates.
+    // When the stride is not one, boundSum only overestimates the number of
+    // backedges and currentSum does not count iterations.
+    MPhi *testPhi;
+    int32_t stride;
+    LinearSum testLimitSum;
+
+    LoopIterationBound(MBasicBlock *header, MTest *test, LinearSum boundSum, LinearSum currentSum,
+                       MPhi *testPhi, int32_t stride, LinearSum testLimitSum)
       : header(header), test(test),
-        boundSum(boundSum), currentSum(currentSum)
+        boundSum(boundSum), currentSum(currentSum),
+        testPhi(testPhi), stride(stride), testLimitSum(testLimitSum)
     {
     }
+
+    bool hasUnitStride() const {
+        return stride == 1 || stride == -1;
+    }
 };
 
 typedef Vector<LoopIterationBound *, 0, SystemAllocPolicy> LoopIterationBoundVector;
@@ -1133,6 +1133,61 @@ RCreateThisWithTemplate::recover(JSContext *cx, SnapshotIterator &iter) const
     return true;
 }
 
+bool
+MLambda::writeRecoverData(CompactBufferWriter &writer) const
+{
+    MOZ_ASSERT(canRecoverOnBailout());
+    writer.writeUnsigned(uint32_t(RInstruction::Recover_Lambda));
+    return true;
+}
+
+RLambda::RLambda(CompactBufferReader &reader)
+{ }
+
+bool
+RLambda::recover(JSContext *cx, SnapshotIterator &iter) const
+{
+    RootedObject scopeChain(cx, &iter.read().toObject());
+    RootedFunction fun(cx, &iter.read().toObject().as<JSFunction>());
+
+    // See CodeGenerator::visitLambda
+    JSObject *resultObject = js::Lambda(cx, fun, scopeChain);
+    if (!resultObject)
+        return false;
+
+    RootedValue result(cx, ObjectValue(*resultObject));
+    iter.storeInstructionResult(result);
+    return true;
+}
+
+bool
+MLambdaArrow::writeRecoverData(CompactBufferWriter &writer) const
+{
+    MOZ_ASSERT(canRecoverOnBailout());
+    writer.writeUnsigned(uint32_t(RInstruction::Recover_LambdaArrow));
+    return true;
+}
+
+RLambdaArrow::RLambdaArrow(CompactBufferReader &reader)
+{ }
+
+bool
+RLambdaArrow::recover(JSContext *cx, SnapshotIterator &iter) const
+{
+    RootedObject scopeChain(cx, &iter.read().toObject());
+    RootedValue thisv(cx, iter.read());
+    RootedFunction fun(cx, &iter.read().toObject().as<JSFunction>());
+
+    // See CodeGenerator::visitLambdaArrow
+    JSObject *resultObject = js::LambdaArrow(cx, fun, scopeChain, thisv);
+    if (!resultObject)
+        return false;
+
+    RootedValue result(cx, ObjectValue(*resultObject));
+    iter.storeInstructionResult(result);
+    return true;
+}
+
 bool
 MObjectState::writeRecoverData(CompactBufferWriter &writer) const
 {
@@ -55,6 +55,8 @@ namespace jit {
     _(NewArray)                                 \
     _(NewDerivedTypedObject)                    \
     _(CreateThisWithTemplate)                   \
+    _(Lambda)                                   \
+    _(LambdaArrow)                              \
     _(ObjectState)                              \
     _(ArrayState)
 
@@ -573,6 +575,30 @@ class RCreateThisWithTemplate MOZ_FINAL : public RInstruction
     bool recover(JSContext *cx, SnapshotIterator &iter) const;
 };
 
+class RLambda MOZ_FINAL : public RInstruction
+{
+  public:
+    RINSTRUCTION_HEADER_(Lambda)
+
+    virtual uint32_t numOperands() const {
+        return 2;
+    }
+
+    bool recover(JSContext *cx, SnapshotIterator &iter) const;
+};
+
+class RLambdaArrow MOZ_FINAL : public RInstruction
+{
+  public:
+    RINSTRUCTION_HEADER_(LambdaArrow)
+
+    virtual uint32_t numOperands() const {
+        return 3;
+    }
+
+    bool recover(JSContext *cx, SnapshotIterator &iter) const;
+};
+
 class RObjectState MOZ_FINAL : public RInstruction
 {
   private:
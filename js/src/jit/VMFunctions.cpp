@@ -12,6 +12,7 @@
 #include "jit/BaselineIC.h"
 #include "jit/IonFrames.h"
 #include "jit/JitCompartment.h"
+#include "jit/JitSpewer.h"
 #include "jit/mips/Simulator-mips.h"
 #include "vm/ArrayObject.h"
 #include "vm/Debugger.h"
@@ -649,6 +650,45 @@ GetIntrinsicValue(JSContext *cx, HandlePropertyName name, MutableHandleValue rva
     return true;
 }
 
+// Get a property for an access site which has run out of optimized IC
+// stubs. Own data properties of native objects are found through the
+// runtime's MegamorphicPropertyCache, everything else takes the generic path.
+bool
+GetPropertyMegamorphic(JSContext *cx, HandleObject obj, HandlePropertyName name,
+                       MutableHandleValue vp)
+{
+    RootedId id(cx, NameToId(name));
+    if (!obj->isNative())
+        return JSObject::getGeneric(cx, obj, obj, id, vp);
+
+    MegamorphicPropertyCache &cache = cx->runtime()->megamorphicPropertyCache;
+    NativeObject *nobj = &obj->as<NativeObject>();
+    uint32_t slot;
+    bool hit = cache.lookup(nobj->lastProperty(), id, &slot);
+
+    // Report periodically, counting hits as well so that a cache which
+    // mostly hits still gets reported.
+    if (((cache.hits + cache.misses) & 0xffff) == 0) {
+        JitSpew(JitSpew_MegamorphicCache, "%llu hits, %llu misses",
+                (unsigned long long) cache.hits, (unsigned long long) cache.misses);
+    }
+
+    if (hit) {
+        vp.set(nobj->getSlot(slot));
+        return true;
+    }
+
+    if (!JSObject::getGeneric(cx, obj, obj, id, vp))
+        return false;
+
+    // Getters and resolve hooks may have changed the object's shape, so only
+    // cache the property once the value has been fetched.
+    Shape *shape = obj->as<NativeObject>().lookupPure(id);
+    if (shape && shape->hasSlot() && shape->hasDefaultGetter())
+        cache.fill(obj->as<NativeObject>().lastProperty(), id, shape->slot());
+    return true;
+}
+
 bool
 CreateThis(JSContext *cx, HandleObject callee, MutableHandleValue rval)
 {
@@ -679,6 +679,9 @@ bool OperatorInI(JSContext *cx, uint32_t index, HandleObject obj, bool *out);
 
 bool GetIntrinsicValue(JSContext *cx, HandlePropertyName name, MutableHandleValue rval);
 
+bool GetPropertyMegamorphic(JSContext *cx, HandleObject obj, HandlePropertyName name,
+                            MutableHandleValue vp);
+
 bool CreateThis(JSContext *cx, HandleObject callee, MutableHandleValue rval);
 
 void GetDynamicName(JSContext *cx, JSObject *scopeChain, JSString *str, Value *vp);
@@ -0,0 +1,44 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+* vim: set ts=8 sts=4 et sw=4 tw=99:
+*/
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifdef JSGC_GENERATIONAL
+
+#include "gc/Heap.h"
+#include "jsapi-tests/tests.h"
+
+BEGIN_TEST(testGCMaxNurseryBytes)
+{
+    const uint32_t chunkSize = uint32_t(js::gc::ChunkSize);
+
+    // By default the nursery may grow to its full reserved size.
+    uint32_t reserved = JS_GetGCParameter(rt, JSGC_MAX_NURSERY_BYTES);
+    CHECK(reserved >= chunkSize);
+    CHECK_EQUAL(reserved % chunkSize, 0u);
+
+    // The limit is rounded down to whole chunks.
+    JS_SetGCParameter(rt, JSGC_MAX_NURSERY_BYTES, chunkSize + chunkSize / 2);
+    CHECK_EQUAL(JS_GetGCParameter(rt, JSGC_MAX_NURSERY_BYTES), chunkSize);
+
+    // The nursery always keeps at least one chunk.
+    JS_SetGCParameter(rt, JSGC_MAX_NURSERY_BYTES, 0);
+    CHECK_EQUAL(JS_GetGCParameter(rt, JSGC_MAX_NURSERY_BYTES), chunkSize);
+
+    // The limit can't exceed the space reserved at startup.
+    JS_SetGCParameter(rt, JSGC_MAX_NURSERY_BYTES, UINT32_MAX);
+    CHECK_EQUAL(JS_GetGCParameter(rt, JSGC_MAX_NURSERY_BYTES), reserved);
+
+    // Allocating under a small limit still works.
+    JS_SetGCParameter(rt, JSGC_MAX_NURSERY_BYTES, chunkSize);
+    JS::RootedValue rval(cx);
+    EVAL("var a = []; for (var i = 0; i < 100000; i++) a.push({i: i}); a.length", &rval);
+    CHECK_SAME(rval, JS::Int32Value(100000));
+
+    return true;
+}
+END_TEST(testGCMaxNurseryBytes)
+
+#endif
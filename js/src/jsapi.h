@@ -2162,7 +2162,15 @@ typedef enum JSGCParamKey {
     JSGC_MIN_EMPTY_CHUNK_COUNT = 21,
 
     /* We never keep more than this many unused chunks in the free chunk pool. */
-    JSGC_MAX_EMPTY_CHUNK_COUNT = 22
+    JSGC_MAX_EMPTY_CHUNK_COUNT = 22,
+
+    /*
+     * The nursery resizes itself based on its promotion rate and how often it
+     * fills up, but never grows beyond this many bytes. The value is rounded
+     * down to a whole number of chunks and limited by the nursery size
+     * reserved when the runtime was created.
+     */
+    JSGC_MAX_NURSERY_BYTES = 23
 } JSGCParamKey;
 
 extern JS_PUBLIC_API(void)
@@ -310,6 +310,15 @@ AtomIsInterned(JSContext *cx, JSAtom *atom)
     return p->isTagged();
 }
 
+JSAtom *
+AtomLookupCache::lookup(const AtomHasher::Lookup &lookup)
+{
+    JSAtom *atom = entries[getIndex(lookup.hash)];
+    if (atom && AtomHasher::match(AtomStateEntry(atom, false), lookup))
+        return atom;
+    return nullptr;
+}
+
 /* |tbchars| must not point into an inline or short string. */
 template <typename CharT>
 MOZ_ALWAYS_INLINE
@@ -325,6 +334,15 @@ AtomizeAndCopyChars(ExclusiveContext *cx, const CharT *tbchars, size_t length, I
     if (pp)
         return pp->asPtr();
 
+    // Helper threads check their own cache before taking the lock. Interning
+    // has to update the atoms table entry, so it always takes the lock.
+    AtomLookupCache *cache = nullptr;
+    if (!cx->isJSContext() && ib == DoNotInternAtom) {
+        cache = &cx->atomLookupCache();
+        if (JSAtom *atom = cache->lookup(lookup))
+            return atom;
+    }
+
     AutoLockForExclusiveAccess lock(cx);
 
     AtomSet& atoms = cx->atoms();
@@ -332,6 +350,8 @@ AtomizeAndCopyChars(ExclusiveContext *cx, const CharT *tbchars, size_t length, I
     if (p) {
         JSAtom *atom = p->asPtr();
         p->setTagged(bool(ib));
+        if (cache)
+            cache->insert(lookup, atom);
         return atom;
     }
 
@@ -356,6 +376,9 @@ AtomizeAndCopyChars(ExclusiveContext *cx, const CharT *tbchars, size_t length, I
         return nullptr;
     }
 
+    if (cache)
+        cache->insert(lookup, atom);
+
     return atom;
 }
 
@@ -8,6 +8,7 @@
 #define jsatom_h
 
 #include "mozilla/HashFunctions.h"
+#include "mozilla/PodOperations.h"
 
 #include "jsalloc.h"
 
@@ -117,6 +118,43 @@ struct AtomHasher
 
 typedef HashSet<AtomStateEntry, AtomHasher, SystemAllocPolicy> AtomSet;
 
+/*
+ * Direct-mapped cache of atoms a helper thread has recently found in or added
+ * to the runtime's atoms table. Off-thread parses atomize the same names over
+ * and over, and every atoms table access needs the exclusive access lock, so
+ * without this they contend with the main thread for each identifier.
+ *
+ * The atoms zone is not collected while there are threads with exclusive
+ * contexts (see JSRuntime::keepAtoms), so entries remain valid as long as the
+ * owning helper thread context is in use.
+ */
+class AtomLookupCache
+{
+    static const size_t SIZE_LOG2 = 8;
+    static const size_t SIZE = size_t(1) << SIZE_LOG2;
+
+    JSAtom *entries[SIZE];
+
+    static size_t getIndex(HashNumber hash) {
+        return hash & (SIZE - 1);
+    }
+
+  public:
+    AtomLookupCache() {
+        clear();
+    }
+
+    void clear() {
+        mozilla::PodArrayZero(entries);
+    }
+
+    JSAtom *lookup(const AtomHasher::Lookup &lookup);
+
+    void insert(const AtomHasher::Lookup &lookup, JSAtom *atom) {
+        entries[getIndex(lookup.hash)] = atom;
+    }
+};
+
 class PropertyName;
 
 }  /* namespace js */
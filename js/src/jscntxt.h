@@ -317,6 +317,9 @@ class ExclusiveContext : public ThreadSafeContext
     // The thread on which this context is running, if this is not a JSContext.
     HelperThread *helperThread_;
 
+    // Atoms recently used by this context, if this is not a JSContext.
+    AtomLookupCache atomLookupCache_;
+
   public:
 
     ExclusiveContext(JSRuntime *rt, PerThreadData *pt, ContextKind kind)
@@ -389,6 +392,10 @@ class ExclusiveContext : public ThreadSafeContext
     AtomSet &atoms() {
         return runtime_->atoms();
     }
+    AtomLookupCache &atomLookupCache() {
+        MOZ_ASSERT(!isJSContext());
+        return atomLookupCache_;
+    }
     JSCompartment *atomsCompartment() {
         return runtime_->atomsCompartment();
     }
@@ -232,6 +232,8 @@ struct JSCompartment
                                 size_t *tiObjectTypeTables,
                                 size_t *compartmentObject,
                                 size_t *compartmentTables,
+                                size_t *baseShapesTable,
+                                size_t *initialShapesTable,
                                 size_t *innerViews,
                                 size_t *crossCompartmentWrappers,
                                 size_t *regexpCompartment,
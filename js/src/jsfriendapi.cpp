@@ -24,6 +24,7 @@
 #include "builtin/TestingFunctions.h"
 #include "proxy/DeadObjectProxy.h"
 #include "vm/ArgumentsObject.h"
+#include "vm/SavedStacks.h"
 #include "vm/WrapperObject.h"
 
 #include "jsobjinlines.h"
@@ -1369,6 +1370,19 @@ js::SetObjectMetadataCallback(JSContext *cx, ObjectMetadataCallback callback)
     cx->compartment()->setObjectMetadataCallback(callback);
 }
 
+JS_FRIEND_API(void)
+js::SetAllocationSamplingProbability(JSContext *cx, double probability)
+{
+    JSCompartment *comp = cx->compartment();
+    if (probability == 0.0) {
+        comp->setObjectMetadataCallback(nullptr);
+        return;
+    }
+
+    comp->savedStacks().setAllocationSamplingProbability(probability);
+    comp->setObjectMetadataCallback(SavedStacksMetadataCallback);
+}
+
 JS_FRIEND_API(bool)
 js::SetObjectMetadata(JSContext *cx, HandleObject obj, HandleObject metadata)
 {
@@ -125,7 +125,10 @@ enum {
     JS_TELEMETRY_GC_NON_INCREMENTAL,
     JS_TELEMETRY_GC_SCC_SWEEP_TOTAL_MS,
     JS_TELEMETRY_GC_SCC_SWEEP_MAX_PAUSE_MS,
-    JS_TELEMETRY_DEPRECATED_LANGUAGE_EXTENSIONS_IN_CONTENT
+    JS_TELEMETRY_DEPRECATED_LANGUAGE_EXTENSIONS_IN_CONTENT,
+    JS_TELEMETRY_ION_COMPILE_QUEUE_WAIT_MS,
+    JS_TELEMETRY_ROPE_FLATTEN_KB,
+    JS_TELEMETRY_ROPE_FLATTEN_DEPTH
 };
 
 typedef void
@@ -2591,6 +2594,17 @@ typedef bool
 JS_FRIEND_API(void)
 SetObjectMetadataCallback(JSContext *cx, ObjectMetadataCallback callback);
 
+/*
+ * Capture the JS stack for a random sample of the objects allocated in the
+ * current compartment, each allocation being sampled with the given
+ * probability, and store it as their metadata. Unlike Debugger.Memory's
+ * allocation tracking this doesn't make the compartment a debuggee. Passing
+ * zero stops sampling. Like SetObjectMetadataCallback, this replaces any
+ * other object metadata callback.
+ */
+JS_FRIEND_API(void)
+SetAllocationSamplingProbability(JSContext *cx, double probability);
+
 /* Manipulate the metadata associated with an object. */
 
 JS_FRIEND_API(bool)
@@ -1433,6 +1433,11 @@ GCRuntime::setParameter(JSGCParamKey key, uint32_t value)
                    mode == JSGC_MODE_COMPARTMENT ||
                    mode == JSGC_MODE_INCREMENTAL);
         break;
+      case JSGC_MAX_NURSERY_BYTES:
+#ifdef JSGC_GENERATIONAL
+        nursery.setMaxActiveChunks(value >> ChunkShift);
+#endif
+        break;
       default:
         tunables.setParameter(key, value);
     }
@@ -1541,6 +1546,12 @@ GCRuntime::getParameter(JSGCParamKey key)
         return tunables.minEmptyChunkCount();
       case JSGC_MAX_EMPTY_CHUNK_COUNT:
         return tunables.maxEmptyChunkCount();
+      case JSGC_MAX_NURSERY_BYTES:
+#ifdef JSGC_GENERATIONAL
+        return uint32_t(nursery.maxActiveChunks() * ChunkSize);
+#else
+        return 0;
+#endif
       default:
         MOZ_ASSERT(key == JSGC_NUMBER);
         return uint32_t(number);
@@ -2120,38 +2131,71 @@ CanRelocateArena(ArenaHeader *arena)
     return arena->getAllocKind() <= FINALIZE_OBJECT_LAST && !ArenaContainsGlobal(arena);
 }
 
+#ifdef JS_GC_ZEAL
 static bool
-ShouldRelocateArena(ArenaHeader *arena)
+ShouldRelocateAllArenas(ArenaHeader *arena)
 {
-#ifdef JS_GC_ZEAL
-    if (arena->zone->runtimeFromMainThread()->gc.zeal() == ZealCompactValue)
-        return true;
+    return arena->zone->runtimeFromMainThread()->gc.zeal() == ZealCompactValue;
+}
 #endif
 
-    /*
-     * Eventually, this will be based on brilliant heuristics that look at fill
-     * percentage and fragmentation and... stuff.
-     */
-    return arena->hasFreeThings();
+static size_t
+CountUsedCells(ArenaHeader *arena)
+{
+    size_t count = 0;
+    for (ArenaCellIterUnderGC i(arena); !i.done(); i.next())
+        count++;
+    return count;
 }
 
 /*
  * Choose some arenas to relocate all cells out of and remove them from the
  * arena list. Return the head of the list of arenas to relocate.
+ *
+ * After sweeping, the arenas following the cursor are sorted from fullest to
+ * emptiest (see SortedArenaList). We relocate the emptiest arenas: the
+ * longest tail of the list whose live cells fit into the free cells of the
+ * arenas that precede it. This frees as many arenas as possible without
+ * allocating new ones to hold the moved cells.
  */
 ArenaHeader *
 ArenaList::pickArenasToRelocate()
 {
     check();
+    if (!head_ || head_->getAllocKind() > FINALIZE_OBJECT_LAST)
+        return nullptr;
+
     ArenaHeader *head = nullptr;
     ArenaHeader **tailp = &head;
 
-    // TODO: Only scan through the arenas with space available.
+#ifdef JS_GC_ZEAL
+    bool relocateAll = ShouldRelocateAllArenas(head_);
+#else
+    bool relocateAll = false;
+#endif
+
     ArenaHeader **arenap = &head_;
+    if (!relocateAll) {
+        size_t thingsPerArena = Arena::thingsPerArena(head_->getThingSize());
+
+        size_t usedCells = 0;
+        for (ArenaHeader *arena = *cursorp_; arena; arena = arena->next)
+            usedCells += CountUsedCells(arena);
+
+        size_t freeCells = 0;
+        arenap = cursorp_;
+        while (*arenap && usedCells > freeCells) {
+            size_t used = CountUsedCells(*arenap);
+            freeCells += thingsPerArena - used;
+            usedCells -= used;
+            arenap = &(*arenap)->next;
+        }
+    }
+
     while (*arenap) {
         ArenaHeader *arena = *arenap;
         MOZ_ASSERT(arena);
-        if (CanRelocateArena(arena) && ShouldRelocateArena(arena)) {
+        if (CanRelocateArena(arena)) {
             // Remove from arena list
             if (cursorp_ == &arena->next)
                 cursorp_ = arenap;
@@ -2465,6 +2509,7 @@ GCRuntime::updatePointersToRelocatedCells()
     // TODO: Should possibly just call PurgeRuntime() here.
     rt->newObjectCache.purge();
     rt->nativeIterCache.purge();
+    rt->megamorphicPropertyCache.purge();
 
     // Call callbacks to get the rest of the system to fixup other untraced pointers.
     callWeakPointerCallbacks();
@@ -2487,7 +2532,6 @@ GCRuntime::releaseRelocatedArenas(ArenaHeader *relocatedList)
     }
 #endif
 
-    unsigned count = 0;
     while (relocatedList) {
         ArenaHeader *aheader = relocatedList;
         relocatedList = relocatedList->next;
@@ -2509,7 +2553,7 @@ GCRuntime::releaseRelocatedArenas(ArenaHeader *relocatedList)
 #endif
 
         aheader->chunk()->releaseArena(aheader);
-        ++count;
+        stats.count(gcstats::STAT_ARENA_RELOCATED);
     }
 
     AutoLockGC lock(rt);
@@ -3527,6 +3571,7 @@ PurgeRuntime(JSRuntime *rt)
     rt->scopeCoordinateNameCache.purge();
     rt->newObjectCache.purge();
     rt->nativeIterCache.purge();
+    rt->megamorphicPropertyCache.purge();
     rt->uncompressedSourceCache.purge();
     rt->evalCache.clear();
 
@@ -996,6 +996,8 @@ class TypeCompilerConstraint : public TypeConstraint
             cx->zone()->types.addPendingRecompile(cx, compilation);
     }
 
+    size_t allocatedSize() const { return sizeof(*this); }
+
     bool sweep(TypeZone &zone, TypeConstraint **res) {
         if (data.shouldSweep() || compilation.shouldSweep(zone))
             return false;
@@ -1177,6 +1179,8 @@ class TypeConstraintFreezeStack : public TypeConstraint
         *res = zone.typeLifoAlloc.new_<TypeConstraintFreezeStack>(script_);
         return true;
     }
+
+    size_t allocatedSize() const { return sizeof(*this); }
 };
 
 } /* anonymous namespace */
@@ -2872,17 +2876,37 @@ TypeCompartment::newTypedObject(JSContext *cx, IdValuePair *properties, size_t n
     if (!p)
         return nullptr;
 
-    RootedNativeObject obj(cx, NewNativeBuiltinClassInstance(cx, &JSObject::class_, allocKind));
-    if (!obj) {
-        cx->clearPendingException();
-        return nullptr;
-    }
-    MOZ_ASSERT(obj->getProto() == p->value().object->proto().toObject());
-
     RootedShape shape(cx, p->value().shape);
-    if (!NativeObject::setLastProperty(cx, obj, shape)) {
-        cx->clearPendingException();
-        return nullptr;
+    RootedTypeObject type(cx, p->value().object);
+    RootedNativeObject obj(cx);
+
+    if (!cx->compartment()->hasObjectMetadataCallback()) {
+        /*
+         * Allocate the object with its final shape, type and slots in one go,
+         * rather than creating an empty object and then changing its shape.
+         * This is the common case when parsing arrays of JSON records which
+         * all have the same properties. JSObject::create doesn't run the
+         * object metadata callback, so when the compartment has one we take
+         * the slower path below, which goes through the normal allocator.
+         */
+        obj = MaybeNativeObject(JSObject::create(cx, allocKind, gc::DefaultHeap, shape, type));
+        if (!obj) {
+            cx->clearPendingException();
+            return nullptr;
+        }
+    } else {
+        obj = NewNativeBuiltinClassInstance(cx, &JSObject::class_, allocKind);
+        if (!obj) {
+            cx->clearPendingException();
+            return nullptr;
+        }
+        MOZ_ASSERT(obj->getProto() == type->proto().toObject());
+
+        if (!NativeObject::setLastProperty(cx, obj, shape)) {
+            cx->clearPendingException();
+            return nullptr;
+        }
+        obj->setType(type);
     }
 
     UpdateObjectTableEntryTypes(cx, p->value(), properties, nproperties);
@@ -2890,7 +2914,6 @@ TypeCompartment::newTypedObject(JSContext *cx, IdValuePair *properties, size_t n
     for (size_t i = 0; i < nproperties; i++)
         obj->setSlot(i, properties[i].value);
 
-    obj->setType(p->value().object);
     return obj;
 }
 
@@ -3381,6 +3404,8 @@ class TypeConstraintClearDefiniteGetterSetter : public TypeConstraint
         *res = zone.typeLifoAlloc.new_<TypeConstraintClearDefiniteGetterSetter>(object);
         return true;
     }
+
+    size_t allocatedSize() const { return sizeof(*this); }
 };
 
 bool
@@ -3432,6 +3457,8 @@ class TypeConstraintClearDefiniteSingle : public TypeConstraint
         *res = zone.typeLifoAlloc.new_<TypeConstraintClearDefiniteSingle>(object);
         return true;
     }
+
+    size_t allocatedSize() const { return sizeof(*this); }
 };
 
 bool
@@ -4974,6 +5001,44 @@ TypeObject::sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf) const
     return mallocSizeOf(newScript_);
 }
 
+size_t
+TypeObject::sizeOfConstraints()
+{
+    if (unknownProperties())
+        return 0;
+
+    size_t n = 0;
+    unsigned count = getPropertyCount();
+    for (unsigned i = 0; i < count; i++) {
+        if (Property *prop = getProperty(i))
+            n += prop->types.sizeOfConstraints();
+    }
+    return n;
+}
+
+size_t
+ConstraintTypeSet::sizeOfConstraints() const
+{
+    size_t n = 0;
+    for (TypeConstraint *constraint = constraintList; constraint; constraint = constraint->next)
+        n += constraint->allocatedSize();
+    return n;
+}
+
+/* static */ size_t
+TypeScript::SizeOfConstraints(JSScript *script)
+{
+    if (!script->types)
+        return 0;
+
+    size_t n = 0;
+    unsigned count = NumTypeSets(script);
+    StackTypeSet *typeArray = script->types->typeArray();
+    for (unsigned i = 0; i < count; i++)
+        n += typeArray[i].sizeOfConstraints();
+    return n;
+}
+
 TypeZone::TypeZone(Zone *zone)
   : zone_(zone),
     typeLifoAlloc(TYPE_LIFO_ALLOC_PRIMARY_CHUNK_SIZE),
@@ -375,6 +375,9 @@ public:
      * zone's new allocator. Type constraints only hold weak references.
      */
     virtual bool sweep(TypeZone &zone, TypeConstraint **res) = 0;
+
+    /* Size of this constraint in the zone's type LifoAlloc. */
+    virtual size_t allocatedSize() const = 0;
 };
 
 /* Flags and other state stored in TypeSet::flags */
@@ -667,6 +670,9 @@ class ConstraintTypeSet : public TypeSet
     bool addConstraint(JSContext *cx, TypeConstraint *constraint, bool callExisting = true);
 
     inline void sweep(JS::Zone *zone, bool *oom);
+
+    /* Total size of the constraints attached to this set. */
+    size_t sizeOfConstraints() const;
 };
 
 class StackTypeSet : public ConstraintTypeSet
@@ -1219,6 +1225,9 @@ struct TypeObject : public gc::TenuredCell
 
     size_t sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf) const;
 
+    /* Size of the constraints attached to this object's property type sets. */
+    size_t sizeOfConstraints();
+
     /*
      * Type objects don't have explicit finalizers. Memory owned by a type
      * object pending deletion is released when weak references are sweeped
@@ -1394,6 +1403,9 @@ class TypeScript
         return mallocSizeOf(this);
     }
 
+    /* Size of the constraints attached to the script's type sets. */
+    static size_t SizeOfConstraints(JSScript *script);
+
 #ifdef DEBUG
     void printTypes(JSContext *cx, HandleScript script) const;
 #endif
@@ -4919,6 +4919,24 @@ my_OOMCallback(JSContext *cx, void *data)
         gGotError = true;
 }
 
+static void
+DumpGCJSONCallback(JSRuntime *rt, JS::GCProgress progress, const JS::GCDescription &desc)
+{
+    if (progress != JS::GC_CYCLE_END)
+        return;
+
+    // One line per major GC, in the same format the browser hands to
+    // garbage-collection-statistics observers.
+    char16_t *json = desc.formatJSON(rt, PRMJ_Now());
+    if (!json)
+        return;
+    for (const char16_t *p = json; *p; p++)
+        fputc(char(*p), gErrFile);
+    fputc('\n', gErrFile);
+    fflush(gErrFile);
+    js_free(json);
+}
+
 static bool
 global_enumerate(JSContext *cx, HandleObject obj)
 {
@@ -5997,6 +6015,8 @@ main(int argc, char **argv, char **envp)
 #ifdef JSGC_GENERATIONAL
         || !op.addBoolOption('\0', "no-ggc", "Disable Generational GC")
 #endif
+        || !op.addBoolOption('\0', "dump-gc-json", "Print statistics for each GC to stderr "
+                             "as one line of JSON")
         || !op.addIntOption('\0', "available-memory", "SIZE",
                             "Select GC settings based on available memory (MB)", 0)
 #if defined(JS_CODEGEN_ARM)
@@ -6105,6 +6125,9 @@ main(int argc, char **argv, char **envp)
         noggc.emplace(rt);
 #endif
 
+    if (op.getBoolOption("dump-gc-json"))
+        JS::SetGCSliceCallback(rt, DumpGCJSONCallback);
+
     size_t availMem = op.getIntOption("available-memory");
     if (availMem > 0)
         JS_SetGCParametersBasedOnAvailableMemory(rt, availMem);
@@ -89,6 +89,7 @@ js::StartOffThreadIonCompile(JSContext *cx, jit::IonBuilder *builder)
 
     AutoLockHelperThreadState lock;
 
+    builder->setEnqueueTime(PRMJ_Now());
     if (!HelperThreadState().ionWorklist().append(builder))
         return false;
 
@@ -569,6 +570,14 @@ GlobalHelperThreadState::canStartAsmJSCompile()
     return true;
 }
 
+static uint32_t
+OsrLoopDepth(jit::IonBuilder *builder)
+{
+    // Loop depths start at one, so zero means this is not an OSR compilation.
+    jsbytecode *osrPc = builder->info().osrPc();
+    return osrPc ? LoopEntryDepthHint(osrPc) : 0;
+}
+
 static bool
 IonBuilderHasHigherPriority(jit::IonBuilder *first, jit::IonBuilder *second)
 {
@@ -583,6 +592,13 @@ IonBuilderHasHigherPriority(jit::IonBuilder *first, jit::IonBuilder *second)
     if (first->script()->hasIonScript() != second->script()->hasIonScript())
         return !first->script()->hasIonScript();
 
+    // An OSR compilation is for a loop which is running in baseline right
+    // now, and the more deeply nested that loop, the hotter it is likely to be.
+    uint32_t firstLoopDepth = OsrLoopDepth(first);
+    uint32_t secondLoopDepth = OsrLoopDepth(second);
+    if (firstLoopDepth != secondLoopDepth)
+        return firstLoopDepth > secondLoopDepth;
+
     // A higher warm-up counter indicates a higher priority.
     return first->script()->getWarmUpCount() / first->script()->length() >
            second->script()->getWarmUpCount() / second->script()->length();
@@ -688,18 +704,23 @@ GlobalHelperThreadState::pendingIonCompileHasSufficientPriority()
 bool
 GlobalHelperThreadState::canStartParseTask()
 {
-    // Don't allow simultaneous off thread parses, to reduce contention on the
-    // atoms table. Note that asm.js compilation depends on this to avoid
-    // stalling the helper thread, as off thread parse tasks can trigger and
-    // block on other off thread asm.js compilation tasks.
+    // Limit the number of simultaneous off thread parses, to reduce contention
+    // on the atoms table. Parses of separate scripts are otherwise independent,
+    // each having its own zone, so a page loading several large scripts can
+    // parse them on different cores. Off thread parse tasks can trigger and
+    // block on other off thread asm.js compilation tasks, but only one such
+    // parallel asm.js compilation may be in progress at a time (see
+    // asmJSCompilationInProgress) and threadCount always exceeds the number
+    // of parse threads, so this cannot stall every helper thread.
     MOZ_ASSERT(isLocked());
     if (parseWorklist().empty())
         return false;
+    size_t numParseThreads = 0;
     for (size_t i = 0; i < threadCount; i++) {
         if (threads[i].parseTask)
-            return false;
+            numParseThreads++;
     }
-    return true;
+    return numParseThreads < maxParseThreads();
 }
 
 bool
@@ -925,6 +946,23 @@ HelperThread::handleIonWorkload()
     jit::IonBuilder *builder =
         HelperThreadState().highestPriorityPendingIonCompile(/* remove = */ true);
 
+    // Don't bother compiling a script which picked up an IonScript at least
+    // as optimized as this one while the builder was waiting in the worklist,
+    // unless the builder is a recompile for a different OSR entry point (see
+    // jit::Compile). The main thread will discard the builder, as for a
+    // failed compilation.
+    JSScript *script = builder->script();
+    jsbytecode *osrPc = builder->info().osrPc();
+    if (builder->info().executionMode() == SequentialExecution &&
+        script->hasIonScript() &&
+        script->ionScript()->optimizationLevel() >= builder->optimizationInfo().level() &&
+        (!osrPc || script->ionScript()->osrPc() == osrPc))
+    {
+        FinishOffThreadIonCompile(builder);
+        HelperThreadState().notifyAll(GlobalHelperThreadState::CONSUMER);
+        return;
+    }
+
     // If there are now too many threads with active IonBuilders, indicate to
     // the one with the lowest priority that it should pause. Note that due to
     // builder priorities changing since pendingIonCompileHasSufficientPriority
@@ -937,6 +975,7 @@ HelperThread::handleIonWorkload()
 
     ionBuilder = builder;
     ionBuilder->setPauseFlag(&pause);
+    ionBuilder->setStartTime(PRMJ_Now());
 
     TraceLogger *logger = TraceLoggerForCurrentThread();
     AutoTraceLog logScript(logger, TraceLogCreateTextId(logger, ionBuilder->script()));
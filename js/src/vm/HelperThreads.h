@@ -96,6 +96,13 @@ class GlobalHelperThreadState
             return 2;
         return cpuCount;
     }
+    size_t maxParseThreads() const {
+        // Off thread parses all contend on the atoms table and the parse map
+        // pool, so only run them on half the available cores.
+        if (cpuCount < 4)
+            return 1;
+        return cpuCount / 2;
+    }
 
     GlobalHelperThreadState();
 
@@ -336,6 +336,8 @@ StatsCompartmentCallback(JSRuntime *rt, void *data, JSCompartment *compartment)
                                         &cStats.typeInferenceObjectTypeTables,
                                         &cStats.compartmentObject,
                                         &cStats.compartmentTables,
+                                        &cStats.baseShapesTable,
+                                        &cStats.initialShapesTable,
                                         &cStats.innerViewsTable,
                                         &cStats.crossCompartmentWrappersTable,
                                         &cStats.regexpCompartment,
@@ -501,6 +503,7 @@ StatsCellCallback(JSRuntime *rt, void *data, void *thing, JSGCTraceKind traceKin
         cStats->scriptsGCHeap += thingSize;
         cStats->scriptsMallocHeapData += script->sizeOfData(rtStats->mallocSizeOf_);
         cStats->typeInferenceTypeScripts += script->sizeOfTypeScript(rtStats->mallocSizeOf_);
+        zStats->typeConstraints += types::TypeScript::SizeOfConstraints(script);
         jit::AddSizeOfBaselineData(script, rtStats->mallocSizeOf_, &cStats->baselineData,
                                    &cStats->baselineStubsFallback);
         cStats->ionData += jit::SizeOfIonData(script, rtStats->mallocSizeOf_);
@@ -552,6 +555,7 @@ StatsCellCallback(JSRuntime *rt, void *data, void *thing, JSGCTraceKind traceKin
         types::TypeObject *obj = static_cast<types::TypeObject *>(thing);
         zStats->typeObjectsGCHeap += thingSize;
         zStats->typeObjectsMallocHeap += obj->sizeOfExcludingThis(rtStats->mallocSizeOf_);
+        zStats->typeConstraints += obj->sizeOfConstraints();
         break;
       }
 
@@ -691,6 +695,15 @@ FindNotableScriptSources(JS::RuntimeSizes &runtime)
     return true;
 }
 
+// Type constraints are allocated in the zone's type pool, which was measured
+// as a whole. Report them separately from the rest of it.
+static void
+SplitTypeConstraintsFromTypePool(ZoneStats &zStats)
+{
+    zStats.typeConstraints = Min(zStats.typeConstraints, zStats.typePool);
+    zStats.typePool -= zStats.typeConstraints;
+}
+
 JS_PUBLIC_API(bool)
 JS::CollectRuntimeStats(JSRuntime *rt, RuntimeStats *rtStats, ObjectPrivateVisitor *opv,
                         bool anonymize)
@@ -732,8 +745,10 @@ JS::CollectRuntimeStats(JSRuntime *rt, RuntimeStats *rtStats, ObjectPrivateVisit
     // We don't look for notable strings for zTotals. So we first sum all the
     // zones' measurements to get the totals. Then we find the notable strings
     // within each zone.
-    for (size_t i = 0; i < zs.length(); i++)
+    for (size_t i = 0; i < zs.length(); i++) {
+        SplitTypeConstraintsFromTypePool(zs[i]);
         zTotals.addSizes(zs[i]);
+    }
 
     for (size_t i = 0; i < zs.length(); i++)
         if (!FindNotableStrings(zs[i]))
@@ -858,6 +873,7 @@ AddSizeOfTab(JSRuntime *rt, HandleObject obj, MallocSizeOf mallocSizeOf, ObjectP
                                        StatsCellCallback<CoarseGrained>);
 
     MOZ_ASSERT(rtStats.zoneStatsVector.length() == 1);
+    SplitTypeConstraintsFromTypePool(rtStats.zoneStatsVector[0]);
     rtStats.zTotals.addSizes(rtStats.zoneStatsVector[0]);
 
     for (size_t i = 0; i < rtStats.compartmentStatsVector.length(); i++)
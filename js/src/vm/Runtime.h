@@ -218,6 +218,66 @@ class NativeIterCache
     }
 };
 
+/*
+ * Cache for own data property reads made by megamorphic property access sites
+ * in the JITs, i.e. sites which have run out of optimized IC stubs. Entries
+ * map an object's last property and a property id to the slot holding the
+ * property's value, so that a hit avoids a Shape::search. As with IC stubs
+ * guarding on an object's shape, a matching last property guarantees the
+ * object's own property layout, but the cache holds raw shape pointers and
+ * must be purged on GC.
+ */
+class MegamorphicPropertyCache
+{
+    static const size_t SIZE = size_t(1) << 9;
+
+    struct Entry
+    {
+        Shape *shape;
+        jsid id;
+        uint32_t slot;
+    };
+
+    Entry entries[SIZE];
+
+    static size_t getIndex(Shape *shape, jsid id) {
+        return size_t((uintptr_t(shape) >> 3) ^ (JSID_BITS(id) >> 3)) % SIZE;
+    }
+
+  public:
+    /* Lookup statistics, reported through the JIT spewer. */
+    uint64_t hits;
+    uint64_t misses;
+
+    MegamorphicPropertyCache()
+      : hits(0), misses(0)
+    {
+        mozilla::PodArrayZero(entries);
+    }
+
+    void purge() {
+        mozilla::PodArrayZero(entries);
+    }
+
+    bool lookup(Shape *shape, jsid id, uint32_t *slotp) {
+        const Entry &entry = entries[getIndex(shape, id)];
+        if (entry.shape == shape && entry.id == id) {
+            hits++;
+            *slotp = entry.slot;
+            return true;
+        }
+        misses++;
+        return false;
+    }
+
+    void fill(Shape *shape, jsid id, uint32_t slot) {
+        Entry &entry = entries[getIndex(shape, id)];
+        entry.shape = shape;
+        entry.id = id;
+        entry.slot = slot;
+    }
+};
+
 /*
  * Cache for speeding up repetitive creation of objects in the VM.
  * When an object is created which matches the criteria in the 'key' section
@@ -1111,6 +1171,7 @@ struct JSRuntime : public JS::shadow::Runtime,
     js::ScopeCoordinateNameCache scopeCoordinateNameCache;
     js::NewObjectCache  newObjectCache;
     js::NativeIterCache nativeIterCache;
+    js::MegamorphicPropertyCache megamorphicPropertyCache;
     js::UncompressedSourceCache uncompressedSourceCache;
     js::EvalCache       evalCache;
     js::LazyScriptCache lazyScriptCache;
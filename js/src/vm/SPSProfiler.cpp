@@ -13,6 +13,7 @@
 #include "jsscript.h"
 
 #include "jit/BaselineJIT.h"
+#include "jit/JitcodeMap.h"
 #include "vm/StringBuffer.h"
 
 using namespace js;
@@ -375,6 +376,32 @@ js::ProfilingGetPC(JSRuntime *rt, JSScript *script, void *ip)
     return rt->spsProfiler.ipToPC(script, size_t(ip));
 }
 
+JS_FRIEND_API(uint32_t)
+js::ProfilingDescribeJitCode(JSRuntime *rt, void *addr, const char **labels, uint32_t maxLabels)
+{
+    if (!rt->spsProfiler.installed())
+        return 0;
+    if (!rt->hasJitRuntime() || !rt->jitRuntime()->hasJitcodeGlobalTable())
+        return 0;
+
+    jit::JitcodeGlobalEntry entry;
+    if (!rt->jitRuntime()->getJitcodeGlobalTable()->lookup(addr, &entry))
+        return 0;
+
+    jit::JitcodeGlobalEntry::BytecodeLocationVector location;
+    uint32_t depth = UINT32_MAX;
+    if (!entry.callStackAtAddr(rt, addr, location, &depth))
+        return 0;
+
+    for (size_t i = 0; i < location.length() && i < maxLabels; i++) {
+        JSScript *script = location[i].script;
+        labels[i] = rt->spsProfiler.profileString(script, script->functionNonDelazifying());
+        if (!labels[i])
+            return 0;
+    }
+    return location.length();
+}
+
 
 
 AutoSuppressProfilerSampling::AutoSuppressProfilerSampling(JSContext *cx
@@ -124,6 +124,11 @@ class SavedStacks {
     uint32_t count();
     void     clear();
     void     setRNGState(uint64_t state) { rngState = state; }
+    void     setAllocationSamplingProbability(double probability) {
+        MOZ_ASSERT(probability >= 0.0 && probability <= 1.0);
+        allocationSamplingProbability = probability;
+        allocationSkipCount = 0;
+    }
 
     size_t sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf);
 
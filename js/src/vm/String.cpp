@@ -285,6 +285,28 @@ CopyChars(Latin1Char *dest, const JSLinearString &str)
 
 } /* namespace js */
 
+/*
+ * Ropes at least this long are reported to telemetry when flattened, along
+ * with their depth. Flattening these is what shows up as a long pause on the
+ * first charAt or regexp match of a string built up from many pieces.
+ */
+static const size_t LargeRopeFlattenLength = 1 << 20;
+
+template <typename CharT>
+static void
+ReportLargeRopeFlatten(ExclusiveContext *maybecx, size_t length, size_t depth)
+{
+    if (!maybecx || !maybecx->isJSContext())
+        return;
+
+    JSAccumulateTelemetryDataCallback cb = maybecx->asJSContext()->runtime()->telemetryCallback;
+    if (!cb)
+        return;
+
+    (*cb)(JS_TELEMETRY_ROPE_FLATTEN_KB, uint32_t((length * sizeof(CharT)) / 1024));
+    (*cb)(JS_TELEMETRY_ROPE_FLATTEN_DEPTH, uint32_t(depth));
+}
+
 template<JSRope::UsingBarrier b, typename CharT>
 JSFlatString *
 JSRope::flattenInternal(ExclusiveContext *maybecx)
@@ -326,6 +348,9 @@ JSRope::flattenInternal(ExclusiveContext *maybecx)
     JSString *str = this;
     CharT *pos;
 
+    /* Depth of str below this node, and the largest depth seen so far. */
+    size_t depth = 0, maxDepth = 0;
+
     /*
      * JSString::flattenData is a tagged pointer to the parent node.
      * The tag indicates what to do when we return to the parent.
@@ -360,6 +385,7 @@ JSRope::flattenInternal(ExclusiveContext *maybecx)
                 str->setNonInlineChars(left.nonInlineChars<CharT>(nogc));
                 child->d.u1.flattenData = uintptr_t(str) | Tag_VisitRightChild;
                 str = child;
+                maxDepth = ++depth;
             }
             if (b == WithIncrementalBarrier) {
                 JSString::writeBarrierPre(str->d.s.u2.left);
@@ -395,6 +421,8 @@ JSRope::flattenInternal(ExclusiveContext *maybecx)
             /* Return to this node when 'left' done, then goto visit_right_child. */
             left.d.u1.flattenData = uintptr_t(str) | Tag_VisitRightChild;
             str = &left;
+            if (++depth > maxDepth)
+                maxDepth = depth;
             goto first_visit_node;
         }
         CopyChars(pos, left.asLinear());
@@ -406,6 +434,8 @@ JSRope::flattenInternal(ExclusiveContext *maybecx)
             /* Return to this node when 'right' done, then goto finish_node. */
             right.d.u1.flattenData = uintptr_t(str) | Tag_FinishNode;
             str = &right;
+            if (++depth > maxDepth)
+                maxDepth = depth;
             goto first_visit_node;
         }
         CopyChars(pos, right.asLinear());
@@ -424,6 +454,8 @@ JSRope::flattenInternal(ExclusiveContext *maybecx)
             str->d.s.u3.capacity = wholeCapacity;
             StringWriteBarrierPostRemove(maybecx, &str->d.s.u2.left);
             StringWriteBarrierPostRemove(maybecx, &str->d.s.u3.right);
+            if (wholeLength >= LargeRopeFlattenLength)
+                ReportLargeRopeFlatten<CharT>(maybecx, wholeLength, maxDepth);
             return &this->asFlat();
         }
         uintptr_t flattenData = str->d.u1.flattenData;
@@ -435,6 +467,7 @@ JSRope::flattenInternal(ExclusiveContext *maybecx)
         str->d.s.u3.base = (JSLinearString *)this;       /* will be true on exit */
         StringWriteBarrierPost(maybecx, (JSString **)&str->d.s.u3.base);
         str = (JSString *)(flattenData & ~Tag_Mask);
+        depth--;
         if ((flattenData & Tag_Mask) == Tag_VisitRightChild)
             goto visit_right_child;
         MOZ_ASSERT((flattenData & Tag_Mask) == Tag_FinishNode);
@@ -164,7 +164,11 @@ struct SCOutput {
 
   private:
     JSContext *cx;
-    Vector<uint64_t> buf;
+
+    // Most messages are small, so start with inline storage rather than
+    // growing a heap buffer from a single word.
+    static const size_t InlineWords = 32;
+    Vector<uint64_t, InlineWords> buf;
 };
 
 class SCInput {
@@ -748,11 +752,13 @@ JS_STATIC_ASSERT(JSString::MAX_LENGTH < UINT32_MAX);
 
 JSStructuredCloneWriter::~JSStructuredCloneWriter()
 {
-    // Free any transferable data left lying around in the buffer
-    uint64_t *data;
-    size_t size;
-    MOZ_ALWAYS_TRUE(extractBuffer(&data, &size));
-    ClearStructuredClone(data, size, callbacks, closure);
+    // Free any transferable data left lying around in the buffer. Nothing is
+    // left if the buffer has already been extracted. Discard in place rather
+    // than extracting, which may need to allocate; the buffer itself is freed
+    // along with |out|.
+    if (!out.count())
+        return;
+    Discard(out.rawBuffer(), out.count() * sizeof(uint64_t), callbacks, closure);
 }
 
 bool
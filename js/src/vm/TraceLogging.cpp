@@ -286,7 +286,7 @@ TraceLogger::flush()
         if (bytesWritten < tree.size())
             return false;
 
-        treeOffset += tree.lastEntryId();
+        treeOffset += tree.size();
         tree.clear();
     }
 
@@ -435,13 +435,18 @@ TraceLogger::createTextId(const JS::ReadOnlyCompileOptions &compileOptions)
 void
 TraceLogger::logTimestamp(uint32_t id)
 {
-    if (enabled == 0)
+    if (failed || enabled == 0)
         return;
 
-    if (!events.ensureSpaceBeforeAdd()) {
-        fprintf(stderr, "TraceLogging: Disabled a tracelogger due to OOM.\n");
-        enabled = 0;
-        return;
+    if (!events.hasSpaceForAdd()) {
+        if (events.capacity() >= MaxBufferedEntries || !events.ensureSpaceBeforeAdd()) {
+            if (!flush()) {
+                fprintf(stderr, "TraceLogging: Couldn't write the data to disk.\n");
+                enabled = 0;
+                failed = true;
+                return;
+            }
+        }
     }
 
     uint64_t time = rdtsc() - traceLoggers.startupTime;
@@ -479,7 +484,7 @@ TraceLogger::getTreeEntry(uint32_t treeId, TreeEntry *entry)
 {
     // Entry is still in memory
     if (treeId >= treeOffset) {
-        *entry = tree[treeId];
+        *entry = tree[treeId - treeOffset];
         return true;
     }
 
@@ -570,7 +575,7 @@ TraceLogger::startEvent(uint32_t id)
 
     if (!tree.hasSpaceForAdd()){
         uint64_t start = rdtsc() - traceLoggers.startupTime;
-        if (!tree.ensureSpaceBeforeAdd()) {
+        if (tree.capacity() >= MaxBufferedEntries || !tree.ensureSpaceBeforeAdd()) {
             if (!flush()) {
                 fprintf(stderr, "TraceLogging: Couldn't write the data to disk.\n");
                 enabled = 0;
@@ -636,7 +641,7 @@ TraceLogger::startEvent(uint32_t id, uint64_t timestamp)
 
     if (parent.lastChildId() == 0) {
         MOZ_ASSERT(!entry.hasChildren());
-        MOZ_ASSERT(parent.treeId() == tree.lastEntryId() + treeOffset);
+        MOZ_ASSERT(parent.treeId() == tree.size() + treeOffset - 1);
 
         if (!updateHasChildren(parent.treeId()))
             return false;
@@ -268,8 +268,20 @@ class TraceLogger
                     PointerHasher<const void *, 3>,
                     SystemAllocPolicy> PointerHashMap;
 
+    // The tree and event logs are kept in memory only up to
+    // MaxBufferedEntries entries per thread. When a buffer is full it is
+    // written out to the log files and reused, so the memory used stays
+    // bounded however long logging is enabled.
+    static const uint32_t MaxBufferedEntries = 1 << 16;
+
     // The layout of the tree in memory and in the log file. Readable by JS
     // using TypedArrays.
+    //
+    // In the tree file every entry takes 24 bytes, stored in big endian:
+    // start and stop timestamps (uint64), the textId shifted left by one with
+    // the hasChildren flag in the low bit (uint32), and the id of the next
+    // sibling or 0 (uint32). An entry's id is its index in the file, and its
+    // first child, if any, directly follows it.
     struct TreeEntry {
         uint64_t start_;
         uint64_t stop_;
@@ -370,7 +382,9 @@ class TraceLogger
     };
 
     // The layout of the event log in memory and in the log file.
-    // Readable by JS using TypedArrays.
+    // Readable by JS using TypedArrays. In the event file every entry is a
+    // big endian timestamp (uint64) followed by its textId (uint32), padded
+    // to 16 bytes.
     struct EventEntry {
         uint64_t time;
         uint32_t textId;
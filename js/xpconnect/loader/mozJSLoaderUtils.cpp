@@ -13,8 +13,10 @@
 #include "nsJSPrincipals.h"
 
 #include "mozilla/scache/StartupCache.h"
+#include "mozilla/Telemetry.h"
 
 using namespace JS;
+using namespace mozilla;
 using namespace mozilla::scache;
 
 // We only serialize scripts with system principals. So we don't serialize the
@@ -28,12 +30,17 @@ ReadCachedScript(StartupCache* cache, nsACString &uri, JSContext *cx,
     uint32_t len;
     nsresult rv = cache->GetBuffer(PromiseFlatCString(uri).get(),
                                    getter_Transfers(buf), &len);
-    if (NS_FAILED(rv))
+    if (NS_FAILED(rv)) {
+        Telemetry::Accumulate(Telemetry::STARTUP_CACHE_JS_SCRIPT_HIT, false);
         return rv; // don't warn since NOT_AVAILABLE is an ok error
+    }
 
     scriptp.set(JS_DecodeScript(cx, buf, len));
+    Telemetry::Accumulate(Telemetry::STARTUP_CACHE_JS_SCRIPT_HIT, !!scriptp);
     if (!scriptp)
         return NS_ERROR_OUT_OF_MEMORY;
+
+    Telemetry::Accumulate(Telemetry::STARTUP_CACHE_JS_SCRIPT_KB, len / 1024);
     return NS_OK;
 }
 
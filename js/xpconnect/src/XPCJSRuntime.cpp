@@ -1877,6 +1877,11 @@ ReportZoneStats(const JS::ZoneStats &zStats,
         zStats.typePool,
         "Type sets and related data.");
 
+    ZCREPORT_BYTES(pathPrefix + NS_LITERAL_CSTRING("type-constraints"),
+        zStats.typeConstraints,
+        "Type constraints which invalidate JIT code or definite property "
+        "information when type sets change.");
+
     ZCREPORT_BYTES(pathPrefix + NS_LITERAL_CSTRING("baseline/optimized-stubs"),
         zStats.baselineStubsOptimized,
         "The Baseline JIT's optimized IC stubs (excluding code).");
@@ -2240,7 +2245,17 @@ ReportCompartmentStats(const JS::CompartmentStats &cStats,
 
     ZCREPORT_BYTES(cJSPathPrefix + NS_LITERAL_CSTRING("compartment-tables"),
         cStats.compartmentTables,
-        "Compartment-wide tables storing shape and type object information.");
+        "Compartment-wide tables storing type object information.");
+
+    ZCREPORT_BYTES(cJSPathPrefix + NS_LITERAL_CSTRING("base-shapes-table"),
+        cStats.baseShapesTable,
+        "The table of unowned base shapes, which are kept separately in each "
+        "compartment.");
+
+    ZCREPORT_BYTES(cJSPathPrefix + NS_LITERAL_CSTRING("initial-shapes-table"),
+        cStats.initialShapesTable,
+        "The table of initial shapes for each combination of class and prototype, "
+        "which are kept separately in each compartment.");
 
     ZCREPORT_BYTES(cJSPathPrefix + NS_LITERAL_CSTRING("inner-views"),
         cStats.innerViewsTable,
@@ -2984,6 +2999,15 @@ AccumulateTelemetryCallback(int id, uint32_t sample)
         MOZ_ASSERT(sample <= 3);
         Telemetry::Accumulate(Telemetry::JS_DEPRECATED_LANGUAGE_EXTENSIONS_IN_CONTENT, sample);
         break;
+      case JS_TELEMETRY_ION_COMPILE_QUEUE_WAIT_MS:
+        Telemetry::Accumulate(Telemetry::JS_ION_COMPILE_QUEUE_WAIT_MS, sample);
+        break;
+      case JS_TELEMETRY_ROPE_FLATTEN_KB:
+        Telemetry::Accumulate(Telemetry::JS_ROPE_FLATTEN_KB, sample);
+        break;
+      case JS_TELEMETRY_ROPE_FLATTEN_DEPTH:
+        Telemetry::Accumulate(Telemetry::JS_ROPE_FLATTEN_DEPTH, sample);
+        break;
       default:
         MOZ_ASSERT_UNREACHABLE("Unexpected JS_TELEMETRY id");
     }
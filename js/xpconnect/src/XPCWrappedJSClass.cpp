@@ -14,6 +14,7 @@
 #include "AccessCheck.h"
 #include "nsJSUtils.h"
 #include "JavaScriptParent.h"
+#include "GeckoProfiler.h"
 #include "mozilla/Attributes.h"
 #include "mozilla/dom/BindingUtils.h"
 #include "mozilla/dom/DOMException.h"
@@ -114,13 +115,18 @@ nsXPCWrappedJSClass::nsXPCWrappedJSClass(JSContext* cx, REFNSIID aIID,
       mInfo(aInfo),
       mName(nullptr),
       mIID(aIID),
-      mDescriptors(nullptr)
+      mDescriptors(nullptr),
+      mMethodIds(nullptr)
 {
     mRuntime->GetWrappedJSClassMap()->Add(this);
 
     uint16_t methodCount;
     if (NS_SUCCEEDED(mInfo->GetMethodCount(&methodCount))) {
         if (methodCount) {
+            mMethodIds = new jsid[methodCount];
+            for (uint16_t i = 0; i < methodCount; i++)
+                mMethodIds[i] = JSID_VOID;
+
             int wordCount = (methodCount/32)+1;
             if (nullptr != (mDescriptors = new uint32_t[wordCount])) {
                 int i;
@@ -149,6 +155,7 @@ nsXPCWrappedJSClass::~nsXPCWrappedJSClass()
 {
     if (mDescriptors && mDescriptors != &zero_methods_descriptor)
         delete [] mDescriptors;
+    delete [] mMethodIds;
     if (mRuntime)
         mRuntime->GetWrappedJSClassMap()->Remove(this);
 
@@ -156,6 +163,25 @@ nsXPCWrappedJSClass::~nsXPCWrappedJSClass()
         nsMemory::Free(mName);
 }
 
+jsid
+nsXPCWrappedJSClass::GetMethodId(JSContext* cx, uint16_t methodIndex,
+                                 const char* name)
+{
+    // Interned strings are never collected, so the ids can be kept across
+    // calls without being traced.
+    if (mMethodIds && !JSID_IS_VOID(mMethodIds[methodIndex]))
+        return mMethodIds[methodIndex];
+
+    JSString* str = JS_InternString(cx, name);
+    if (!str)
+        return JSID_VOID;
+
+    jsid id = INTERNED_STRING_TO_JSID(cx, str);
+    if (mMethodIds)
+        mMethodIds[methodIndex] = id;
+    return id;
+}
+
 JSObject*
 nsXPCWrappedJSClass::CallQueryInterfaceOnJSObject(JSContext* cx,
                                                   JSObject* jsobjArg,
@@ -881,6 +907,9 @@ nsXPCWrappedJSClass::CallMethod(nsXPCWrappedJS* wrapper, uint16_t methodIndex,
     const char* name = info->name;
     bool foundDependentParam;
 
+    PROFILER_LABEL_PRINTF("XPCWrappedJS", "CallMethod",
+      js::ProfileEntry::Category::JS, "%s.%s", GetInterfaceName(), name);
+
     // Make sure not to set the callee on ccx until after we've gone through
     // the whole nsIXPCFunctionThisTranslator bit.  That code uses ccx to
     // convert natives to JSObjects, but we do NOT plan to pass those JSObjects
@@ -919,6 +948,10 @@ nsXPCWrappedJSClass::CallMethod(nsXPCWrappedJS* wrapper, uint16_t methodIndex,
 
     JSAutoCompartment ac(cx, obj);
 
+    RootedId methodId(cx, GetMethodId(cx, methodIndex, name));
+    if (JSID_IS_VOID(methodId))
+        return NS_ERROR_OUT_OF_MEMORY;
+
     AutoValueVector args(cx);
     AutoScriptEvaluate scriptEval(cx);
 
@@ -1008,7 +1041,7 @@ nsXPCWrappedJSClass::CallMethod(nsXPCWrappedJS* wrapper, uint16_t methodIndex,
                 }
             }
         } else {
-            if (!JS_GetProperty(cx, obj, name, &fval))
+            if (!JS_GetPropertyById(cx, obj, methodId, &fval))
                 goto pre_call_clean_up;
             // XXX We really want to factor out the error reporting better and
             // specifically report the failure to find a function with this name.
@@ -1175,10 +1208,10 @@ pre_call_clean_up:
 
     RootedValue rval(cx);
     if (XPT_MD_IS_GETTER(info->flags)) {
-        success = JS_GetProperty(cx, obj, name, &rval);
+        success = JS_GetPropertyById(cx, obj, methodId, &rval);
     } else if (XPT_MD_IS_SETTER(info->flags)) {
         rval = *argv;
-        success = JS_SetProperty(cx, obj, name, rval);
+        success = JS_SetPropertyById(cx, obj, methodId, rval);
     } else {
         if (!fval.isPrimitive()) {
             AutoSaveContextOptions asco(cx);
@@ -2371,6 +2371,8 @@ private:
         {if (b) mDescriptors[i/32] |= (1 << (i%32));
          else mDescriptors[i/32] &= ~(1 << (i%32));}
 
+    jsid GetMethodId(JSContext* cx, uint16_t methodIndex, const char* name);
+
     bool GetArraySizeFromParam(JSContext* cx,
                                const XPTMethodDescriptor* method,
                                const nsXPTParamInfo& param,
@@ -2400,6 +2402,7 @@ private:
     char* mName;
     nsIID mIID;
     uint32_t* mDescriptors;
+    jsid* mMethodIds;
 };
 
 /*************************/
@@ -2257,7 +2257,7 @@ nsCSSRendering::PaintGradient(nsPresContext* aPresContext,
                     "The parser should reject gradients with less than two stops");
 
   // Build color stop array and compute stop positions
-  nsTArray<ColorStop> stops;
+  nsAutoTArray<ColorStop, 4> stops;
   // If there is a run of stops before stop i that did not have specified
   // positions, then this is the index of the first stop in that run, otherwise
   // it's -1.
@@ -2517,7 +2517,7 @@ nsCSSRendering::PaintGradient(nsPresContext* aPresContext,
   // much memory (ram and/or GPU ram) and can be expensive to create. So we cache it.
   // The cache key correlates 1:1 with the arguments for CreateGradientStops (also the implied backend type)
   // Note that GradientStop is a simple struct with a stop value (while GradientStops has the surface).
-  nsTArray<gfx::GradientStop> rawStops(stops.Length());
+  nsAutoTArray<gfx::GradientStop, 4> rawStops;
   rawStops.SetLength(stops.Length());
   for(uint32_t i = 0; i < stops.Length(); i++) {
     rawStops[i].color = gfx::Color(stops[i].mColor.r, stops[i].mColor.g, stops[i].mColor.b, stops[i].mColor.a);
@@ -53,6 +53,7 @@
 #include "mozilla/EventStates.h"
 #include "mozilla/LookAndFeel.h"
 #include "mozilla/Preferences.h"
+#include "mozilla/Telemetry.h"
 #include "mozilla/UniquePtr.h"
 #include "ActiveLayerTracker.h"
 #include "nsContentUtils.h"
@@ -1309,11 +1310,16 @@ void nsDisplayList::PaintForFrame(nsDisplayListBuilder* aBuilder,
     props = Move(LayerProperties::CloneFrom(layerManager->GetRoot()));
   }
 
+  TimeStamp layerizeStart = TimeStamp::Now();
   ContainerLayerParameters containerParameters
     (presShell->GetXResolution(), presShell->GetYResolution());
   nsRefPtr<ContainerLayer> root = layerBuilder->
     BuildContainerLayerFor(aBuilder, layerManager, aForFrame, nullptr, this,
                            containerParameters, nullptr);
+  if (widgetTransaction) {
+    Telemetry::AccumulateTimeDelta(Telemetry::PAINT_LAYERIZE_TIME,
+                                   layerizeStart);
+  }
 
   nsIDocument* document = nullptr;
   if (presShell) {
@@ -139,10 +139,17 @@ nsPresArena::FreeListEnumerator(FreeList* aEntry, void* aData)
   // list here.  The free list knows how many objects we've allocated
   // ever (which includes any objects that may be on the FreeList's
   // |mEntries| at this point) and we're using that to determine the
-  // total size of objects allocated with a given ID.
-  size_t totalSize = aEntry->mEntrySize * aEntry->mEntriesEverAllocated;
+  // total size of objects allocated with a given ID.  Entries waiting on
+  // the free list are reported separately, so that the per-type numbers
+  // only cover live objects and drop when the frame tree shrinks.
+  size_t freeSize = aEntry->mEntrySize * aEntry->mEntries.Length();
+  size_t totalSize =
+    aEntry->mEntrySize * aEntry->mEntriesEverAllocated - freeSize;
   size_t* p;
 
+  data->stats->mFreeEntries += freeSize;
+  data->total += freeSize;
+
   switch (NS_PTR_TO_INT32(aEntry->mKey)) {
 #define FRAME_ID(classname)                                      \
     case nsQueryFrame::classname##_id:                           \
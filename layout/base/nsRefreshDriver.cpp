@@ -1160,15 +1160,23 @@ nsRefreshDriver::Tick(int64_t aNowEpoch, TimeStamp aNowTime)
    */
   for (uint32_t i = 0; i < ArrayLength(mObservers); ++i) {
     ObserverArray::EndLimitedIterator etor(mObservers[i]);
+    bool tracingObservers = etor.HasMore();
+    if (tracingObservers) {
+      profiler_tracing("Paint", "Observers", TRACING_INTERVAL_START);
+    }
     while (etor.HasMore()) {
       nsRefPtr<nsARefreshObserver> obs = etor.GetNext();
       obs->WillRefresh(aNowTime);
       
       if (!mPresContext || !mPresContext->GetPresShell()) {
+        profiler_tracing("Paint", "Observers", TRACING_INTERVAL_END);
         StopTimer();
         return;
       }
     }
+    if (tracingObservers) {
+      profiler_tracing("Paint", "Observers", TRACING_INTERVAL_END);
+    }
 
     if (i == 0) {
       // This is the Flush_Style case.
@@ -1371,6 +1371,52 @@ nsFlexContainerFrame::
   }
 }
 
+// The result of a flex item's last measuring reflow, along with the parts of
+// the measuring reflow state that it depends on. A flex item that isn't dirty
+// and is measured with the same inputs again would produce the same height,
+// so we can skip the (potentially deep) measuring reflow. Without this, every
+// level of nested column flexboxes doubles the number of reflows below it.
+struct CachedMeasuringReflowResult
+{
+  explicit CachedMeasuringReflowResult(const nsHTMLReflowState& aRS)
+    : mAvailableWidth(aRS.AvailableWidth())
+    , mComputedWidth(aRS.ComputedWidth())
+    , mComputedHeight(aRS.ComputedHeight())
+    , mComputedMinHeight(aRS.ComputedMinHeight())
+    , mComputedMaxHeight(aRS.ComputedMaxHeight())
+    , mBorderPaddingHeight(aRS.ComputedPhysicalBorderPadding().TopBottom())
+    , mContentHeight(0)
+  {}
+
+  bool IsValidFor(const nsHTMLReflowState& aRS) const
+  {
+    return mAvailableWidth == aRS.AvailableWidth() &&
+           mComputedWidth == aRS.ComputedWidth() &&
+           mComputedHeight == aRS.ComputedHeight() &&
+           mComputedMinHeight == aRS.ComputedMinHeight() &&
+           mComputedMaxHeight == aRS.ComputedMaxHeight() &&
+           mBorderPaddingHeight ==
+             aRS.ComputedPhysicalBorderPadding().TopBottom();
+  }
+
+  nscoord mAvailableWidth;
+  nscoord mComputedWidth;
+  nscoord mComputedHeight;
+  nscoord mComputedMinHeight;
+  nscoord mComputedMaxHeight;
+  nscoord mBorderPaddingHeight;
+  nscoord mContentHeight;
+};
+
+static void
+DestroyCachedMeasuringReflowResult(void* aPropertyValue)
+{
+  delete static_cast<CachedMeasuringReflowResult*>(aPropertyValue);
+}
+
+NS_DECLARE_FRAME_PROPERTY(CachedFlexMeasuringReflowProperty,
+                          DestroyCachedMeasuringReflowResult)
+
 nscoord
 nsFlexContainerFrame::
   MeasureFlexItemContentHeight(nsPresContext* aPresContext,
@@ -1398,6 +1444,19 @@ nsFlexContainerFrame::
     childRSForMeasuringHeight.mFlags.mVResize = true;
   }
 
+  // If nothing inside the item has changed since it was last measured with
+  // these inputs, reuse that measurement. We don't flag the item as having
+  // had a measuring reflow in that case, since its frame still holds the
+  // state from its last "real" reflow.
+  FrameProperties props = aFlexItem.Frame()->Properties();
+  CachedMeasuringReflowResult* cached =
+    static_cast<CachedMeasuringReflowResult*>(
+      props.Get(CachedFlexMeasuringReflowProperty()));
+  if (cached && !NS_SUBTREE_DIRTY(aFlexItem.Frame()) &&
+      cached->IsValidFor(childRSForMeasuringHeight)) {
+    return cached->mContentHeight;
+  }
+
   nsHTMLReflowMetrics childDesiredSize(childRSForMeasuringHeight);
   nsReflowStatus childReflowStatus;
   const uint32_t flags = NS_FRAME_NO_MOVE_FRAME;
@@ -1419,8 +1478,17 @@ nsFlexContainerFrame::
   // the effective computed value of the "height" property.
   nscoord childDesiredHeight = childDesiredSize.Height() -
     childRSForMeasuringHeight.ComputedPhysicalBorderPadding().TopBottom();
+  childDesiredHeight = std::max(0, childDesiredHeight);
+
+  if (!cached) {
+    cached = new CachedMeasuringReflowResult(childRSForMeasuringHeight);
+    props.Set(CachedFlexMeasuringReflowProperty(), cached);
+  } else {
+    *cached = CachedMeasuringReflowResult(childRSForMeasuringHeight);
+  }
+  cached->mContentHeight = childDesiredHeight;
 
-  return std::max(0, childDesiredHeight);
+  return childDesiredHeight;
 }
 
 FlexItem::FlexItem(nsHTMLReflowState& aFlexItemReflowState,
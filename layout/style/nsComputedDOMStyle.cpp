@@ -675,6 +675,41 @@ nsComputedDOMStyle::ClearCurrentStyleSources()
   mStyleContextHolder = nullptr;
 }
 
+/* static */ bool
+nsComputedDOMStyle::NeedsLayoutFlushOnlyForPercentage(nsCSSProperty aProperty)
+{
+  switch (aProperty) {
+    case eCSSProperty_max_height:
+    case eCSSProperty_max_width:
+    case eCSSProperty_min_height:
+    case eCSSProperty_min_width:
+    case eCSSProperty_text_indent:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool
+nsComputedDOMStyle::ValueHasPercentage(nsCSSProperty aProperty)
+{
+  switch (aProperty) {
+    case eCSSProperty_max_height:
+      return StylePosition()->mMaxHeight.HasPercent();
+    case eCSSProperty_max_width:
+      return StylePosition()->mMaxWidth.HasPercent();
+    case eCSSProperty_min_height:
+      return StylePosition()->mMinHeight.HasPercent();
+    case eCSSProperty_min_width:
+      return StylePosition()->mMinWidth.HasPercent();
+    case eCSSProperty_text_indent:
+      return StyleText()->mTextIndent.HasPercent();
+    default:
+      NS_NOTREACHED("unexpected property");
+      return true;
+  }
+}
+
 already_AddRefed<CSSValue>
 nsComputedDOMStyle::GetPropertyCSSValue(const nsAString& aPropertyName, ErrorResult& aRv)
 {
@@ -718,7 +753,13 @@ nsComputedDOMStyle::GetPropertyCSSValue(const nsAString& aPropertyName, ErrorRes
     getter = propEntry->mGetter;
   }
 
-  UpdateCurrentStyleSources(needsLayoutFlush);
+  bool deferLayoutFlush =
+    needsLayoutFlush && NeedsLayoutFlushOnlyForPercentage(prop);
+  UpdateCurrentStyleSources(needsLayoutFlush && !deferLayoutFlush);
+  if (deferLayoutFlush && mStyleContextHolder && ValueHasPercentage(prop)) {
+    ClearCurrentStyleSources();
+    UpdateCurrentStyleSources(true);
+  }
   if (!mStyleContextHolder) {
     aRv.Throw(NS_ERROR_NOT_AVAILABLE);
     return nullptr;
@@ -148,6 +148,12 @@ private:
   void UpdateCurrentStyleSources(bool aNeedsLayoutFlush);
   void ClearCurrentStyleSources();
 
+  // Some properties that need a layout flush only need it to resolve
+  // percentages against the containing block.  For those, we flush style
+  // first and only flush layout if the value turns out to have a percentage.
+  static bool NeedsLayoutFlushOnlyForPercentage(nsCSSProperty aProperty);
+  bool ValueHasPercentage(nsCSSProperty aProperty);
+
 #define STYLE_STRUCT(name_, checkdata_cb_)                              \
   const nsStyle##name_ * Style##name_() {                               \
     return mStyleContextHolder->Style##name_();                         \
@@ -9204,7 +9204,7 @@ nsRuleNode::SweepHashEntry(PLDHashTable *table, PLDHashEntryHdr *hdr,
   return PL_DHASH_NEXT;
 }
 
-void
+uint32_t
 nsRuleNode::SweepChildren(nsTArray<nsRuleNode*>& aSweepQueue)
 {
   NS_ASSERTION(!(mDependentBits & NS_RULE_NODE_GC_MARK),
@@ -9212,12 +9212,14 @@ nsRuleNode::SweepChildren(nsTArray<nsRuleNode*>& aSweepQueue)
   NS_ASSERTION(HaveChildren(),
                "why call SweepChildren with no children?");
   uint32_t childrenDestroyed = 0;
+  uint32_t childrenSurvived = 0;
   nsRuleNode* survivorsWithChildren = nullptr;
   if (ChildrenAreHashed()) {
     PLDHashTable* children = ChildrenHash();
     uint32_t oldChildCount = children->EntryCount();
     PL_DHashTableEnumerate(children, SweepHashEntry, &survivorsWithChildren);
-    childrenDestroyed = oldChildCount - children->EntryCount();
+    childrenSurvived = children->EntryCount();
+    childrenDestroyed = oldChildCount - childrenSurvived;
     if (childrenDestroyed == oldChildCount) {
       PL_DHashTableDestroy(children);
       mChildren.asVoid = nullptr;
@@ -9232,6 +9234,7 @@ nsRuleNode::SweepChildren(nsTArray<nsRuleNode*>& aSweepQueue)
         ++childrenDestroyed;
       } else {
         children = &(*children)->mNextSibling;
+        ++childrenSurvived;
       }
     }
     survivorsWithChildren = ChildrenList();
@@ -9245,18 +9248,24 @@ nsRuleNode::SweepChildren(nsTArray<nsRuleNode*>& aSweepQueue)
                    "We didn't get swept, so we'd better have style contexts "
                    "pointing to us or to one of our descendants, which means "
                    "we'd better have a nonzero mRefCnt here!");
+  return childrenSurvived;
 }
 
 bool
-nsRuleNode::Sweep()
+nsRuleNode::Sweep(uint32_t* aSurvivorCount)
 {
   NS_ASSERTION(IsRoot(), "must start sweeping at a root");
   NS_ASSERTION(!mNextSibling, "root must not have mNextSibling");
 
+  if (aSurvivorCount) {
+    *aSurvivorCount = 0;
+  }
+
   if (DestroyIfNotMarked()) {
     return true;
   }
 
+  uint32_t survivors = 0;
   nsAutoTArray<nsRuleNode*, 70> sweepQueue;
   sweepQueue.AppendElement(this);
   while (!sweepQueue.IsEmpty()) {
@@ -9265,10 +9274,13 @@ nsRuleNode::Sweep()
     sweepQueue.RemoveElementAt(last);
     for (; ruleNode; ruleNode = ruleNode->mNextSibling) {
       if (ruleNode->HaveChildren()) {
-        ruleNode->SweepChildren(sweepQueue);
+        survivors += ruleNode->SweepChildren(sweepQueue);
       }
     }
   }
+  if (aSurvivorCount) {
+    *aSurvivorCount = survivors;
+  }
   return false;
 }
 
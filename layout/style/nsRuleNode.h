@@ -313,7 +313,8 @@ private:
   static PLDHashOperator
   SweepHashEntry(PLDHashTable *table, PLDHashEntryHdr *hdr,
                  uint32_t number, void *arg);
-  void SweepChildren(nsTArray<nsRuleNode*>& aSweepQueue);
+  // Returns the number of children that survived.
+  uint32_t SweepChildren(nsTArray<nsRuleNode*>& aSweepQueue);
   bool DestroyIfNotMarked();
 
   static const PLDHashTableOps ChildrenHashOps;
@@ -736,11 +737,13 @@ public:
    * ancestors until it reaches a marked one.  Sweep recursively sweeps
    * the children, destroys any that are unmarked, and clears marks,
    * returning true if the node on which it was called was destroyed.
+   * If aSurvivorCount is non-null, it is set to the number of nodes left
+   * in the tree, not counting the root.
    * If children are hashed, the mNextSibling field on the children is
    * temporarily used internally by Sweep.
    */
   void Mark();
-  bool Sweep();
+  bool Sweep(uint32_t* aSurvivorCount = nullptr);
 
   static bool
     HasAuthorSpecifiedRules(nsStyleContext* aStyleContext,
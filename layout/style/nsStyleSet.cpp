@@ -38,6 +38,7 @@
 #include "nsPrintfCString.h"
 #include "nsIFrame.h"
 #include "RestyleManager.h"
+#include <algorithm>
 
 using namespace mozilla;
 using namespace mozilla::dom;
@@ -130,6 +131,12 @@ nsDisableTextZoomStyleRule::List(FILE* out, int32_t aIndent) const
 }
 #endif
 
+// We GC the rule trees once at least this many rule nodes are unused...
+static const uint32_t kGCInterval = 300;
+// ...and, for larger trees, once there is one unused rule node for every
+// this many rule nodes that survived the previous GC.
+static const uint32_t kGCLiveNodesPerUnusedNode = 4;
+
 static const nsStyleSet::sheetType gCSSSheetTypes[] = {
   // From lowest to highest in cascading order.
   nsStyleSet::eAgentSheet,
@@ -147,7 +154,8 @@ nsStyleSet::nsStyleSet()
     mInReconstruct(false),
     mInitFontFeatureValuesLookup(true),
     mDirty(0),
-    mUnusedRuleNodeCount(0)
+    mUnusedRuleNodeCount(0),
+    mUnusedRuleNodeGCThreshold(kGCInterval)
 {
 }
 
@@ -2026,8 +2034,6 @@ nsStyleSet::Shutdown(nsPresContext* aPresContext)
   mOldRuleTrees.Clear();
 }
 
-static const uint32_t kGCInterval = 300;
-
 void
 nsStyleSet::NotifyStyleContextDestroyed(nsPresContext* aPresContext,
                                         nsStyleContext* aStyleContext)
@@ -2044,7 +2050,7 @@ nsStyleSet::NotifyStyleContextDestroyed(nsPresContext* aPresContext,
   if (mInReconstruct)
     return;
 
-  if (mUnusedRuleNodeCount >= kGCInterval) {
+  if (mUnusedRuleNodeCount >= mUnusedRuleNodeGCThreshold) {
     GCRuleTrees();
   }
 }
@@ -2063,12 +2069,19 @@ nsStyleSet::GCRuleTrees()
   }
 
   // Sweep the rule tree.
+  uint32_t survivors;
 #ifdef DEBUG
   bool deleted =
 #endif
-    mRuleTree->Sweep();
+    mRuleTree->Sweep(&survivors);
   NS_ASSERTION(!deleted, "Root node must not be gc'd");
 
+  // Each GC walks the whole rule tree, so wait for the garbage to grow in
+  // proportion to the tree's size before doing the next one.  This keeps
+  // the cost of GC proportional to the number of rule nodes freed.
+  mUnusedRuleNodeGCThreshold =
+    std::max(kGCInterval, survivors / kGCLiveNodesPerUnusedNode);
+
   // Sweep the old rule trees.
   for (uint32_t i = mOldRuleTrees.Length(); i > 0; ) {
     --i;
@@ -476,6 +476,7 @@ class nsStyleSet
   unsigned mDirty : 10;  // one dirty bit is used per sheet type
 
   uint32_t mUnusedRuleNodeCount; // used to batch rule node GC
+  uint32_t mUnusedRuleNodeGCThreshold; // mUnusedRuleNodeCount to GC at
   nsTArray<nsStyleContext*> mRoots; // style contexts with no parent
 
   // Empty style rules to force things that restrict which properties
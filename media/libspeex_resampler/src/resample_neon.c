@@ -199,4 +199,21 @@ float inner_product_single(const float *a, const float *b, unsigned int len)
                     "q9", "q10", "q11");
     return ret;
 }
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+/* Only works when len % 2 == 0 */
+float interpolate_product_single(const float *a, const float *b, unsigned int len, const spx_uint32_t oversample, float *frac)
+{
+    unsigned int i;
+    float32x4_t sum = vdupq_n_f32(0.f);
+    float32x2_t halves;
+    for (i = 0; i < len; i += 2) {
+        sum = vmlaq_n_f32(sum, vld1q_f32(b + i * oversample), a[i]);
+        sum = vmlaq_n_f32(sum, vld1q_f32(b + (i + 1) * oversample), a[i + 1]);
+    }
+    sum = vmulq_f32(sum, vld1q_f32(frac));
+    halves = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    halves = vpadd_f32(halves, halves);
+    return vget_lane_f32(halves, 0);
+}
 #endif
@@ -21,7 +21,7 @@ int moz_speex_have_double_simd();
 #define inner_product_single CAT_PREFIX(RANDOM_PREFIX,_inner_product_single)
 spx_word32_t inner_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len);
 #endif
-#if defined(_USE_SSE)
+#if defined(_USE_SSE) || (defined(_USE_NEON) && defined(FLOATING_POINT))
 #define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
 #define interpolate_product_single CAT_PREFIX(RANDOM_PREFIX,_interpolate_product_single)
 spx_word32_t interpolate_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len, const spx_uint32_t oversample, float *frac);
@@ -44,6 +44,7 @@
 #endif
 #include "mozilla/gfx/Point.h"
 #include "mozilla/gfx/Types.h"
+#include "mozilla/UniquePtr.h"
 
 #include "webrtc/modules/interface/module_common_types.h"
 #include "webrtc/modules/rtp_rtcp/interface/rtp_header_parser.h"
@@ -58,6 +59,11 @@ namespace mozilla {
 
 static char kDTLSExporterLabel[] = "EXTRACTOR-dtls_srtp";
 
+// Incoming packets are copied before SRTP unprotects them in place. They
+// come off UDP or TCP sockets and nearly always fit in an MTU-sized buffer,
+// so copy them to the stack instead of allocating a buffer per packet.
+static const size_t kStackPacketBufferSize = 2048;
+
 MediaPipeline::~MediaPipeline() {
   ASSERT_ON_THREAD(main_thread_);
   MOZ_ASSERT(!stream_);  // Check that we have shut down already.
@@ -470,8 +476,13 @@ void MediaPipeline::RtpPacketReceived(TransportLayer *layer,
   MOZ_ASSERT(!possible_bundle_rtcp_);
 
   // Make a copy rather than cast away constness
-  ScopedDeletePtr<unsigned char> inner_data(
-      new unsigned char[len]);
+  unsigned char stack_data[kStackPacketBufferSize];
+  UniquePtr<unsigned char[]> heap_data;
+  unsigned char *inner_data = stack_data;
+  if (len > sizeof(stack_data)) {
+    heap_data.reset(new unsigned char[len]);
+    inner_data = heap_data.get();
+  }
   memcpy(inner_data, data, len);
   int out_len = 0;
   nsresult res = rtp_.recv_srtp_->UnprotectRtp(inner_data,
@@ -562,8 +573,13 @@ void MediaPipeline::RtcpPacketReceived(TransportLayer *layer,
   MOZ_ASSERT(info->recv_srtp_);  // This should never happen
 
   // Make a copy rather than cast away constness
-  ScopedDeletePtr<unsigned char> inner_data(
-      new unsigned char[len]);
+  unsigned char stack_data[kStackPacketBufferSize];
+  UniquePtr<unsigned char[]> heap_data;
+  unsigned char *inner_data = stack_data;
+  if (len > sizeof(stack_data)) {
+    heap_data.reset(new unsigned char[len]);
+    inner_data = heap_data.get();
+  }
   memcpy(inner_data, data, len);
   int out_len;
 
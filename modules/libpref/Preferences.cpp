@@ -526,11 +526,10 @@ Preferences::Init()
   rv = PREF_Init();
   NS_ENSURE_SUCCESS(rv, rv);
 
-  rv = pref_InitInitialObjects();
-  NS_ENSURE_SUCCESS(rv, rv);
-
   using mozilla::dom::ContentChild;
   if (XRE_GetProcessType() == GeckoProcessType_Content) {
+    // The parent sends both the default and the user value of every pref, so
+    // there is no need to parse the default pref files here as well.
     InfallibleTArray<PrefSetting> prefs;
     ContentChild::GetSingleton()->SendReadPrefsArray(&prefs);
 
@@ -541,6 +540,9 @@ Preferences::Init()
     return NS_OK;
   }
 
+  rv = pref_InitInitialObjects();
+  NS_ENSURE_SUCCESS(rv, rv);
+
   nsXPIDLCString lockFileName;
   /*
    * The following is a small hack which will allow us to only load the library
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include "ArrayBufferInputStream.h"
 #include "nsStreamUtils.h"
+#include "nsThreadUtils.h"
 #include "jsapi.h"
 #include "jsfriendapi.h"
 
@@ -13,6 +14,7 @@ NS_IMPL_ISUPPORTS(ArrayBufferInputStream, nsIArrayBufferInputStream, nsIInputStr
 
 ArrayBufferInputStream::ArrayBufferInputStream()
 : mBuffer(nullptr)
+, mOwnsBuffer(false)
 , mBufferLength(0)
 , mOffset(0)
 , mPos(0)
@@ -20,6 +22,16 @@ ArrayBufferInputStream::ArrayBufferInputStream()
 {
 }
 
+ArrayBufferInputStream::~ArrayBufferInputStream()
+{
+  // Only streams that took their data may be released off the main thread;
+  // mArrayBuffer is a JS root.
+  MOZ_ASSERT_IF(mArrayBuffer, NS_IsMainThread());
+  if (mOwnsBuffer) {
+    JS_free(nullptr, mBuffer);
+  }
+}
+
 NS_IMETHODIMP
 ArrayBufferInputStream::SetData(JS::Handle<JS::Value> aBuffer,
                                 uint32_t aByteOffset,
@@ -30,7 +42,7 @@ ArrayBufferInputStream::SetData(JS::Handle<JS::Value> aBuffer,
     return NS_ERROR_FAILURE;
   }
   JS::RootedObject arrayBuffer(aCx, &aBuffer.toObject());
-  if (!JS_IsArrayBufferObject(arrayBuffer)) {
+  if (!JS_IsArrayBufferObject(arrayBuffer) || mOwnsBuffer) {
     return NS_ERROR_FAILURE;
   }
 
@@ -46,6 +58,31 @@ ArrayBufferInputStream::SetData(JS::Handle<JS::Value> aBuffer,
   return NS_OK;
 }
 
+NS_IMETHODIMP
+ArrayBufferInputStream::TakeData(JS::Handle<JS::Value> aBuffer,
+                                 JSContext* aCx)
+{
+  if (!aBuffer.isObject()) {
+    return NS_ERROR_FAILURE;
+  }
+  JS::RootedObject arrayBuffer(aCx, &aBuffer.toObject());
+  if (!JS_IsArrayBufferObject(arrayBuffer) || mArrayBuffer || mOwnsBuffer) {
+    return NS_ERROR_FAILURE;
+  }
+
+  uint32_t buflen = JS_GetArrayBufferByteLength(arrayBuffer);
+  uint8_t* data = static_cast<uint8_t*>(JS_StealArrayBufferContents(aCx, arrayBuffer));
+  if (!data) {
+    return NS_ERROR_FAILURE;
+  }
+
+  mBuffer = data;
+  mOwnsBuffer = true;
+  mOffset = 0;
+  mBufferLength = buflen;
+  return NS_OK;
+}
+
 NS_IMETHODIMP
 ArrayBufferInputStream::Close()
 {
@@ -89,7 +126,7 @@ ArrayBufferInputStream::ReadSegments(nsWriteSegmentFun writer, void *closure,
       return NS_BASE_STREAM_CLOSED;
     }
   } else {
-    MOZ_ASSERT(remaining == 0, "stream inited incorrectly");
+    MOZ_ASSERT(mOwnsBuffer || remaining == 0, "stream inited incorrectly");
   }
 
   if (!remaining) {
@@ -22,14 +22,15 @@
 class ArrayBufferInputStream : public nsIArrayBufferInputStream {
 public:
   ArrayBufferInputStream();
-  NS_DECL_ISUPPORTS
+  NS_DECL_THREADSAFE_ISUPPORTS
   NS_DECL_NSIARRAYBUFFERINPUTSTREAM
   NS_DECL_NSIINPUTSTREAM
 
 private:
-  virtual ~ArrayBufferInputStream() {}
+  virtual ~ArrayBufferInputStream();
   mozilla::Maybe<JS::PersistentRooted<JS::Value> > mArrayBuffer;
   uint8_t* mBuffer; // start of actual buffer
+  bool mOwnsBuffer; // mBuffer holds contents stolen by TakeData
   uint32_t mBufferLength; // length of slice
   uint32_t mOffset; // permanent offset from start of actual buffer
   uint32_t mPos; // offset from start of slice
@@ -2022,15 +2022,25 @@ Predictor::LearnForSubresource(const UriInfo &targetURI,
                                  hostInfo);
   }
 
+  // A subresource (and, far more often, a subhost) can be requested many
+  // times during a single top-level load. Its row already records that load
+  // once last_hit matches the parent's last_load, so rewriting it would only
+  // cost us a database write (and inflate the hit count).
   if (haveResource) {
-    UpdateSubresource(QUERY_PAGE, resourceInfo, pageInfo.lastLoad, pageInfo.loadCount);
+    if (resourceInfo.lastHit != pageInfo.lastLoad) {
+      UpdateSubresource(QUERY_PAGE, resourceInfo, pageInfo.lastLoad,
+                        pageInfo.loadCount);
+    }
   } else if (havePage) {
     AddSubresource(QUERY_PAGE, pageInfo.id, targetURI.spec, pageInfo.lastLoad);
   }
   // Can't add a subresource to a page we don't have in our db.
 
   if (haveHost) {
-    UpdateSubresource(QUERY_ORIGIN, hostInfo, originInfo.lastLoad, originInfo.loadCount);
+    if (hostInfo.lastHit != originInfo.lastLoad) {
+      UpdateSubresource(QUERY_ORIGIN, hostInfo, originInfo.lastLoad,
+                        originInfo.loadCount);
+    }
   } else if (haveOrigin) {
     AddSubresource(QUERY_ORIGIN, originInfo.id, targetURI.origin, originInfo.lastLoad);
   }
@@ -23,6 +23,7 @@
 #include "mozilla/PublicSSL.h"
 #include "mozilla/ChaosMode.h"
 #include "mozilla/PodOperations.h"
+#include "mozilla/Telemetry.h"
 #include "nsThreadUtils.h"
 #include "nsIFile.h"
 
@@ -741,7 +742,12 @@ nsSocketTransportService::Run()
                 thread->HasPendingEvents(&pendingEvents);
 
             if (pendingEvents) {
+                TimeStamp eventStart;
+                if (Telemetry::CanRecord())
+                    eventStart = TimeStamp::Now();
                 NS_ProcessNextEvent(thread);
+                if (!eventStart.IsNull())
+                    Telemetry::AccumulateTimeDelta(Telemetry::STS_EVENT_TIME_MS, eventStart);
                 pendingEvents = false;
                 thread->HasPendingEvents(&pendingEvents);
             }
@@ -875,6 +881,11 @@ nsSocketTransportService::DoPollIteration(bool wait)
         SOCKET_LOG(("  PR_Poll error [%d]\n", PR_GetError()));
     }
     else {
+        TimeStamp serviceStart;
+        if (Telemetry::CanRecord())
+            serviceStart = TimeStamp::Now();
+        uint32_t readyCalls = 0;
+
         //
         // service "active" sockets...
         //
@@ -884,6 +895,7 @@ nsSocketTransportService::DoPollIteration(bool wait)
             if (n > 0 && desc.out_flags != 0) {
                 s.mElapsedTime = 0;
                 s.mHandler->OnSocketReady(desc.fd, desc.out_flags);
+                readyCalls++;
             }
             // check for timeout errors unless disabled...
             else if (s.mHandler->mPollTimeout != UINT16_MAX) {
@@ -902,6 +914,7 @@ nsSocketTransportService::DoPollIteration(bool wait)
                 if (s.mElapsedTime >= s.mHandler->mPollTimeout) {
                     s.mElapsedTime = 0;
                     s.mHandler->OnSocketReady(desc.fd, -1);
+                    readyCalls++;
                 }
             }
         }
@@ -915,6 +928,15 @@ nsSocketTransportService::DoPollIteration(bool wait)
                 DetachSocket(mActiveList, &mActiveList[i]);
         }
 
+        // Only iterations which did some work are interesting; most of them
+        // just wake up to process an event.
+        if (!serviceStart.IsNull() && readyCalls) {
+            Telemetry::AccumulateTimeDelta(Telemetry::STS_SOCKET_SERVICE_TIME_MS,
+                                           serviceStart);
+            Telemetry::Accumulate(Telemetry::STS_NUMBER_OF_ONSOCKETREADY_CALLS,
+                                  readyCalls);
+        }
+
         if (n != 0 && mPollList[0].out_flags == PR_POLL_READ) {
             // acknowledge pollable event (wait should not block)
             if (PR_WaitForPollableEvent(mThreadEvent) != PR_SUCCESS) {
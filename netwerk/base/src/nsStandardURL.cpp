@@ -20,12 +20,14 @@
 #include "nsIProgrammingLanguage.h"
 #include "nsIURLParser.h"
 #include "nsNetCID.h"
+#include "mozilla/Maybe.h"
 #include "mozilla/MemoryReporting.h"
 #include "mozilla/ipc/URIUtils.h"
 #include <algorithm>
 #include "mozilla/dom/EncodingUtils.h"
 
 using mozilla::dom::EncodingUtils;
+using mozilla::Maybe;
 using namespace mozilla::ipc;
 
 static NS_DEFINE_CID(kThisImplCID, NS_THIS_STANDARDURL_IMPL_CID);
@@ -1144,9 +1146,14 @@ nsStandardURL::SetSpec(const nsACString &input)
     if (!spec || !*spec)
         return NS_ERROR_MALFORMED_URI;
 
-    // Make a backup of the curent URL
-    nsStandardURL prevURL(false,false);
-    prevURL.CopyMembers(this, eHonorRef);
+    // Make a backup of the curent URL. Most calls initialize a freshly
+    // created URL, which has nothing worth restoring beyond what Clear()
+    // already resets, so don't pay for building the copy in that case.
+    Maybe<nsStandardURL> prevURL;
+    if (!mSpec.IsEmpty()) {
+        prevURL.emplace(false, false);
+        prevURL->CopyMembers(this, eHonorRef);
+    }
     Clear();
 
     // filter out unexpected chars "\r\n\t" if necessary
@@ -1168,7 +1175,9 @@ nsStandardURL::SetSpec(const nsACString &input)
         Clear();
         // If parsing the spec has failed, restore the old URL
         // so we don't end up with an empty URL.
-        CopyMembers(&prevURL, eHonorRef);
+        if (prevURL.isSome()) {
+            CopyMembers(prevURL.ptr(), eHonorRef);
+        }
         return rv;
     }
 
@@ -119,6 +119,7 @@ CacheFileHandle::CacheFileHandle(const SHA1Sum::Hash *aHash, bool aPriority)
   , mFileExists(false)
   , mFileSize(-1)
   , mFD(nullptr)
+  , mFDOffset(-1)
 {
   LOG(("CacheFileHandle::CacheFileHandle() [this=%p, hash=%08x%08x%08x%08x%08x]"
        , this, LOGSHA1(aHash)));
@@ -134,6 +135,7 @@ CacheFileHandle::CacheFileHandle(const nsACString &aKey, bool aPriority)
   , mFileExists(false)
   , mFileSize(-1)
   , mFD(nullptr)
+  , mFDOffset(-1)
   , mKey(aKey)
 {
   LOG(("CacheFileHandle::CacheFileHandle() [this=%p, key=%s]", this,
@@ -1840,12 +1842,11 @@ CacheFileIOManager::ReadInternal(CacheFileHandle *aHandle, int64_t aOffset,
     return NS_ERROR_NOT_AVAILABLE;
   }
 
-  int64_t offset = PR_Seek64(aHandle->mFD, aOffset, PR_SEEK_SET);
-  if (offset == -1) {
-    return NS_ERROR_FAILURE;
-  }
+  rv = SeekNSPRHandle(aHandle, aOffset);
+  NS_ENSURE_SUCCESS(rv, rv);
 
   int32_t bytesRead = PR_Read(aHandle->mFD, aBuf, aCount);
+  aHandle->mFDOffset = bytesRead == -1 ? -1 : aOffset + bytesRead;
   if (bytesRead != aCount) {
     return NS_ERROR_FAILURE;
   }
@@ -1930,12 +1931,11 @@ CacheFileIOManager::WriteInternal(CacheFileHandle *aHandle, int64_t aOffset,
   // Write invalidates the entry by default
   aHandle->mInvalid = true;
 
-  int64_t offset = PR_Seek64(aHandle->mFD, aOffset, PR_SEEK_SET);
-  if (offset == -1) {
-    return NS_ERROR_FAILURE;
-  }
+  rv = SeekNSPRHandle(aHandle, aOffset);
+  NS_ENSURE_SUCCESS(rv, rv);
 
   int32_t bytesWritten = PR_Write(aHandle->mFD, aBuf, aCount);
+  aHandle->mFDOffset = bytesWritten == -1 ? -1 : aOffset + bytesWritten;
 
   if (bytesWritten != -1 && aHandle->mFileSize < aOffset+bytesWritten) {
     aHandle->mFileSize = aOffset+bytesWritten;
@@ -2163,6 +2163,7 @@ CacheFileIOManager::ReleaseNSPRHandleInternal(CacheFileHandle *aHandle)
 
   PR_Close(aHandle->mFD);
   aHandle->mFD = nullptr;
+  aHandle->mFDOffset = -1;
 
   return NS_OK;
 }
@@ -2362,6 +2363,9 @@ CacheFileIOManager::TruncateSeekSetEOFInternal(CacheFileHandle *aHandle,
   // This operation always invalidates the entry
   aHandle->mInvalid = true;
 
+  // Truncating may move the file pointer on some platforms.
+  aHandle->mFDOffset = -1;
+
   rv = TruncFile(aHandle->mFD, static_cast<uint32_t>(aTruncatePos));
   NS_ENSURE_SUCCESS(rv, rv);
 
@@ -3609,10 +3613,31 @@ CacheFileIOManager::OpenNSPRHandle(CacheFileHandle *aHandle, bool aCreate)
     NS_ENSURE_SUCCESS(rv, rv);
   }
 
+  aHandle->mFDOffset = 0;
   mHandlesByLastUsed.AppendElement(aHandle);
   return NS_OK;
 }
 
+nsresult
+CacheFileIOManager::SeekNSPRHandle(CacheFileHandle *aHandle, int64_t aOffset)
+{
+  MOZ_ASSERT(CacheFileIOManager::IsOnIOThreadOrCeased());
+  MOZ_ASSERT(aHandle->mFD);
+
+  // Chunks are usually read and written in order, so the file is often
+  // already positioned where the next operation starts.
+  if (aHandle->mFDOffset == aOffset) {
+    return NS_OK;
+  }
+
+  aHandle->mFDOffset = PR_Seek64(aHandle->mFD, aOffset, PR_SEEK_SET);
+  if (aHandle->mFDOffset == -1) {
+    return NS_ERROR_FAILURE;
+  }
+
+  return NS_OK;
+}
+
 void
 CacheFileIOManager::NSPRHandleUsed(CacheFileHandle *aHandle)
 {
@@ -82,6 +82,7 @@ private:
   nsCOMPtr<nsIFile>    mFile;
   int64_t              mFileSize;
   PRFileDesc          *mFD;  // if null then the file doesn't exists on the disk
+  int64_t              mFDOffset; // current offset of mFD, -1 if unknown
   nsCString            mKey;
 };
 
@@ -360,6 +361,7 @@ private:
   nsresult CreateCacheTree();
   nsresult OpenNSPRHandle(CacheFileHandle *aHandle, bool aCreate = false);
   void     NSPRHandleUsed(CacheFileHandle *aHandle);
+  nsresult SeekNSPRHandle(CacheFileHandle *aHandle, int64_t aOffset);
 
   // Removing all cache files during shutdown
   nsresult SyncRemoveDir(nsIFile *aFile, const char *aDir);
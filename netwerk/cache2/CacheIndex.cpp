@@ -25,6 +25,7 @@
 #define kMinUnwrittenChanges   300
 #define kMinDumpInterval       20000 // in milliseconds
 #define kMaxBufSize            16384
+#define kMaxReadBufSize        65536 // reading happens in fewer, larger steps
 #define kIndexVersion          0x00000001
 #define kUpdateIndexStartDelay 50000 // in milliseconds
 
@@ -3145,7 +3146,7 @@ CacheIndex::AllocBuffer()
       }
       break;
     case READING:
-      mRWBufSize = kMaxBufSize;
+      mRWBufSize = kMaxReadBufSize;
       break;
     default:
       MOZ_ASSERT(false, "Unexpected state!");
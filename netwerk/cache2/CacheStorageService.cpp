@@ -1411,6 +1411,12 @@ CacheStorageService::AddStorageEntry(nsCSubstring const& aContextKey,
       entryExists = false;
     }
 
+    if (aWriteToDisk && !aReplace) {
+      // A disk entry still present in the table serves at least its metadata
+      // from memory, without going through a read on the IO thread.
+      Telemetry::Accumulate(Telemetry::NETWORK_CACHE_V2_MEMORY_HIT, entryExists);
+    }
+
     // Ensure entry for the particular URL, if not read/only
     if (!entryExists && (aCreateIfNotExist || aReplace)) {
       // Entry is not in the hashtable or has just been truncated...
@@ -1233,6 +1233,7 @@ nsHostResolver::IssueLookup(nsHostRecord *rec)
     
     rec->resolving = true;
     rec->onQueue = true;
+    rec->mQueueStart = TimeStamp::Now();
 
     rv = ConditionallyCreateThread(rec);
     
@@ -1594,6 +1595,14 @@ nsHostResolver::ThreadFunc(void *arg)
         TimeStamp startTime = TimeStamp::Now();
         MOZ_EVENT_TRACER_EXEC(rec, "net::dns::resolve");
 
+        // Time spent waiting for a resolver thread, which grows when more
+        // hosts are looked up at once than there are threads.
+        if (!rec->mQueueStart.IsNull()) {
+            Telemetry::AccumulateTimeDelta(Telemetry::DNS_QUEUE_TIME_MS,
+                                           rec->mQueueStart, startTime);
+            rec->mQueueStart = TimeStamp();
+        }
+
 #if TTL_AVAILABLE
         bool getTtl = rec->mGetTtl;
 #else
@@ -136,6 +136,10 @@ private:
     bool    usingAnyThread; /* true if off queue and contributing to mActiveAnyThreadCount */
     bool    mDoomed; /* explicitly expired */
 
+    // When the record was put on a pending queue, null once a worker thread
+    // has picked it up.
+    mozilla::TimeStamp mQueueStart;
+
 #if TTL_AVAILABLE
     bool    mGetTtl;
 #endif
@@ -1064,6 +1064,20 @@ Http2Compressor::HuffmanAppend(const nsCString &value)
   uint32_t offset;
   uint8_t *startByte;
 
+  // Mostly random values, such as tokens and hashes, get longer when
+  // Huffman encoded. Send those as plain literals instead.
+  uint64_t huffBits = 0;
+  for (uint32_t i = 0; i < length; ++i) {
+    huffBits += HuffmanOutgoing[static_cast<uint8_t>(value[i])].mLength;
+  }
+  if (((huffBits + 7) / 8) >= length) {
+    EncodeInteger(7, length);
+    mOutput->Append(value);
+    LOG(("Http2Compressor::HuffmanAppend %p sent %d byte original as a plain "
+         "literal.\n", this, length));
+    return;
+  }
+
   for (uint32_t i = 0; i < length; ++i) {
     uint8_t idx = static_cast<uint8_t>(value[i]);
     uint8_t huffLength = HuffmanOutgoing[idx].mLength;
@@ -1643,6 +1643,11 @@ Http2Session::RecvPing(Http2Session *self)
 
   if (self->mInputFrameFlags & kFlag_ACK) {
     // presumably a reply to our timeout ping.. don't reply to it
+    if (self->mPingSentEpoch) {
+      PRIntervalTime rtt = PR_IntervalNow() - self->mPingSentEpoch;
+      Telemetry::Accumulate(Telemetry::SPDY_PING_RTT_MS,
+                            PR_IntervalToMilliseconds(rtt));
+    }
     self->mPingSentEpoch = 0;
   } else {
     // reply with a ack'd ping
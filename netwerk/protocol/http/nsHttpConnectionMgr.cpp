@@ -293,10 +293,23 @@ nsHttpConnectionMgr::AddTransaction(nsHttpTransaction *trans, int32_t priority)
 {
     LOG(("nsHttpConnectionMgr::AddTransaction [trans=%p %d]\n", trans, priority));
 
-    NS_ADDREF(trans);
-    nsresult rv = PostEvent(&nsHttpConnectionMgr::OnMsgNewTransaction, priority, trans);
+    EnsureSocketThreadTarget();
+
+    ReentrantMonitorAutoEnter mon(mReentrantMonitor);
+
+    // a page with many subresources adds them in quick succession, so rather
+    // than posting one event per transaction let the event that is already
+    // pending pick this one up as well.
+    bool postNeeded = mNewTransactions.IsEmpty();
+    NewTransaction *newTrans = mNewTransactions.AppendElement();
+    newTrans->mTrans = trans;
+    newTrans->mPriority = priority;
+    if (!postNeeded)
+        return NS_OK;
+
+    nsresult rv = PostEvent(&nsHttpConnectionMgr::OnMsgNewTransaction);
     if (NS_FAILED(rv))
-        NS_RELEASE(trans);
+        mNewTransactions.Clear();
     return rv;
 }
 
@@ -887,6 +900,26 @@ nsHttpConnectionMgr::ProcessOneTransactionCB(const nsACString &key,
     return PL_DHASH_NEXT;
 }
 
+// Finds the entry whose most urgent pending transaction has the best
+// (numerically lowest) nsISupportsPriority, so that a freed connection slot
+// goes to e.g. the foreground page rather than to whichever host happens to
+// come first in the hash table.
+PLDHashOperator
+nsHttpConnectionMgr::FindBestPendingEntryCB(const nsACString &key,
+                                            nsAutoPtr<nsConnectionEntry> &ent,
+                                            void *closure)
+{
+    nsBestPendingEntryArgs *args = static_cast<nsBestPendingEntryArgs *>(closure);
+
+    // the pending queue is sorted, so its head is its most urgent transaction
+    if (ent->mPendingQ.Length() &&
+        (!args->mEnt || ent->mPendingQ[0]->Priority() < args->mPriority)) {
+        args->mEnt = ent;
+        args->mPriority = ent->mPendingQ[0]->Priority();
+    }
+    return PL_DHASH_NEXT;
+}
+
 PLDHashOperator
 nsHttpConnectionMgr::ProcessAllTransactionsCB(const nsACString &key,
                                               nsAutoPtr<nsConnectionEntry> &ent,
@@ -2306,16 +2339,26 @@ nsHttpConnectionMgr::OnMsgShutdownConfirm(int32_t priority, void *param)
 }
 
 void
-nsHttpConnectionMgr::OnMsgNewTransaction(int32_t priority, void *param)
+nsHttpConnectionMgr::OnMsgNewTransaction(int32_t, void *)
 {
-    LOG(("nsHttpConnectionMgr::OnMsgNewTransaction [trans=%p]\n", param));
+    MOZ_ASSERT(PR_GetCurrentThread() == gSocketThread);
 
-    nsHttpTransaction *trans = (nsHttpTransaction *) param;
-    trans->SetPriority(priority);
-    nsresult rv = ProcessNewTransaction(trans);
-    if (NS_FAILED(rv))
-        trans->Close(rv); // for whatever its worth
-    NS_RELEASE(trans);
+    nsTArray<NewTransaction> batch;
+    {
+        ReentrantMonitorAutoEnter mon(mReentrantMonitor);
+        batch.SwapElements(mNewTransactions);
+    }
+
+    LOG(("nsHttpConnectionMgr::OnMsgNewTransaction [count=%u]\n",
+         batch.Length()));
+
+    for (uint32_t i = 0; i < batch.Length(); ++i) {
+        nsHttpTransaction *trans = batch[i].mTrans;
+        trans->SetPriority(batch[i].mPriority);
+        nsresult rv = ProcessNewTransaction(trans);
+        if (NS_FAILED(rv))
+            trans->Close(rv); // for whatever its worth
+    }
 }
 
 void
@@ -2427,8 +2470,12 @@ nsHttpConnectionMgr::OnMsgProcessPendingQ(int32_t, void *param)
     nsConnectionEntry *ent = mCT.Get(ci->HashKey());
     if (!(ent && ProcessPendingQForEntry(ent, false))) {
         // if we reach here, it means that we couldn't dispatch a transaction
-        // for the specified connection info.  walk the connection table...
-        mCT.Enumerate(ProcessOneTransactionCB, this);
+        // for the specified connection info. give the most urgent pending
+        // transaction the first chance, then walk the connection table...
+        nsBestPendingEntryArgs args = { nullptr, 0 };
+        mCT.Enumerate(FindBestPendingEntryCB, &args);
+        if (!(args.mEnt && ProcessPendingQForEntry(args.mEnt, false)))
+            mCT.Enumerate(ProcessOneTransactionCB, this);
     }
 
     NS_RELEASE(ci);
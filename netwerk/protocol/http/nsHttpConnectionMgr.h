@@ -524,11 +524,25 @@ private:
     uint16_t mMaxOptimisticPipelinedRequests;
     bool mIsShuttingDown;
 
+    // transactions added since the last OnMsgNewTransaction ran. only the
+    // first addition to an empty list posts an event to the socket thread,
+    // which then picks up the whole batch.
+    struct NewTransaction {
+        nsRefPtr<nsHttpTransaction> mTrans;
+        int32_t                     mPriority;
+    };
+    nsTArray<NewTransaction> mNewTransactions;
+
     //-------------------------------------------------------------------------
     // NOTE: these members are only accessed on the socket transport thread
     //-------------------------------------------------------------------------
 
     static PLDHashOperator ProcessOneTransactionCB(const nsACString &, nsAutoPtr<nsConnectionEntry> &, void *);
+    static PLDHashOperator FindBestPendingEntryCB(const nsACString &, nsAutoPtr<nsConnectionEntry> &, void *);
+    struct nsBestPendingEntryArgs {
+        nsConnectionEntry *mEnt;
+        int32_t            mPriority;
+    };
     static PLDHashOperator ProcessAllTransactionsCB(const nsACString &, nsAutoPtr<nsConnectionEntry> &, void *);
 
     static PLDHashOperator PruneDeadConnectionsCB(const nsACString &, nsAutoPtr<nsConnectionEntry> &, void *);
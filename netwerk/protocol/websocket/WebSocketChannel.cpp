@@ -1631,29 +1631,32 @@ WebSocketChannel::ApplyMask(uint32_t mask, uint8_t *data, uint64_t len)
   if (!data || len == 0)
     return;
 
-  // Optimally we want to apply the mask 32 bits at a time,
+  // Optimally we want to apply the mask 64 bits at a time,
   // but the buffer might not be alligned. So we first deal with
-  // 0 to 3 bytes of preamble individually
+  // 0 to 7 bytes of preamble individually
 
-  while (len && (reinterpret_cast<uintptr_t>(data) & 3)) {
+  while (len && (reinterpret_cast<uintptr_t>(data) & 7)) {
     *data ^= mask >> 24;
     mask = RotateLeft(mask, 8);
     data++;
     len--;
   }
 
-  // perform mask on full words of data
+  // perform mask on full words of data. Both halves of the wide mask hold
+  // the same four bytes in network order, so it is the same on either
+  // endianness.
 
-  uint32_t *iData = (uint32_t *) data;
-  uint32_t *end = iData + (len / 4);
-  NetworkEndian::writeUint32(&mask, mask);
+  uint32_t netMask;
+  NetworkEndian::writeUint32(&netMask, mask);
+  uint64_t wideMask = (static_cast<uint64_t>(netMask) << 32) | netMask;
+  uint64_t *iData = (uint64_t *) data;
+  uint64_t *end = iData + (len / 8);
   for (; iData < end; iData++)
-    *iData ^= mask;
-  mask = NetworkEndian::readUint32(&mask);
+    *iData ^= wideMask;
   data = (uint8_t *)iData;
-  len  = len % 4;
+  len  = len % 8;
 
-  // There maybe up to 3 trailing bytes that need to be dealt with
+  // There maybe up to 7 trailing bytes that need to be dealt with
   // individually 
 
   while (len) {
@@ -12,12 +12,14 @@
 #include "nsStreamUtils.h"
 #include "nsStringStream.h"
 #include "nsComponentManagerUtils.h"
+#include "nsThreadUtils.h"
 
 // nsISupports implementation
 NS_IMPL_ISUPPORTS(nsHTTPCompressConv,
                   nsIStreamConverter,
                   nsIStreamListener,
-                  nsIRequestObserver)
+                  nsIRequestObserver,
+                  nsIThreadRetargetableStreamListener)
 
 // nsFTPDirListingConv methods
 nsHTTPCompressConv::nsHTTPCompressConv()
@@ -311,6 +313,21 @@ nsHTTPCompressConv::OnDataAvailable(nsIRequest* request,
 	return NS_OK;
 } /* OnDataAvailable */
 
+// Inflating has no thread affinity, so it can follow the rest of the chain
+// off the main thread if the final listener allows it.
+NS_IMETHODIMP
+nsHTTPCompressConv::CheckListenerChain()
+{
+    NS_ASSERTION(NS_IsMainThread(), "Should be on main thread!");
+    nsresult rv;
+    nsCOMPtr<nsIThreadRetargetableStreamListener> retargetableListener =
+        do_QueryInterface(mListener, &rv);
+    if (!retargetableListener) {
+        return NS_ERROR_NO_INTERFACE;
+    }
+    return retargetableListener->CheckListenerChain();
+}
+
 
 // XXX/ruslan: need to implement this too
 
@@ -7,6 +7,7 @@
 #define	__nsHTTPCompressConv__h__	1
 
 #include "nsIStreamConverter.h"
+#include "nsIThreadRetargetableStreamListener.h"
 #include "nsCOMPtr.h"
 
 #include "zlib.h"
@@ -38,13 +39,15 @@ typedef enum    {
         HTTP_COMPRESS_IDENTITY
     }   CompressMode;
 
-class nsHTTPCompressConv	: public nsIStreamConverter	{
+class nsHTTPCompressConv	: public nsIStreamConverter
+                          , public nsIThreadRetargetableStreamListener {
 public:
     // nsISupports methods
     NS_DECL_THREADSAFE_ISUPPORTS
 
 	NS_DECL_NSIREQUESTOBSERVER
     NS_DECL_NSISTREAMLISTENER
+    NS_DECL_NSITHREADRETARGETABLESTREAMLISTENER
 
     // nsIStreamConverter methods
     NS_DECL_NSISTREAMCONVERTER
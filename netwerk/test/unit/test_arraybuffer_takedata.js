@@ -0,0 +1,54 @@
+/* Any copyright is dedicated to the Public Domain.
+   http://creativecommons.org/publicdomain/zero/1.0/ */
+
+// nsIArrayBufferInputStream.takeData() moves an ArrayBuffer's contents into
+// the stream, neutering the buffer.
+
+const Cc = Components.classes;
+const Ci = Components.interfaces;
+
+function newStream() {
+  return Cc["@mozilla.org/io/arraybuffer-input-stream;1"]
+           .createInstance(Ci.nsIArrayBufferInputStream);
+}
+
+function readAll(stream) {
+  let bis = Cc["@mozilla.org/binaryinputstream;1"]
+              .createInstance(Ci.nsIBinaryInputStream);
+  bis.setInputStream(stream);
+  return bis.readByteArray(stream.available());
+}
+
+function checkThrows(f) {
+  let threw = false;
+  try {
+    f();
+  } catch (e) {
+    threw = true;
+  }
+  do_check_true(threw);
+}
+
+function run_test() {
+  let buffer = new ArrayBuffer(4);
+  new Uint8Array(buffer).set([1, 2, 3, 250]);
+
+  let stream = newStream();
+  stream.takeData(buffer);
+  do_check_eq(buffer.byteLength, 0);
+  do_check_eq(stream.available(), 4);
+  do_check_eq(readAll(stream).join(","), "1,2,3,250");
+  do_check_eq(stream.available(), 0);
+
+  // A stream can't be initialized twice.
+  let other = new ArrayBuffer(2);
+  checkThrows(function() { stream.takeData(other); });
+  checkThrows(function() { stream.setData(other, 0, 2); });
+  do_check_eq(other.byteLength, 2);
+
+  // Neither can a stream whose data was set.
+  let setStream = newStream();
+  setStream.setData(other, 0, 2);
+  checkThrows(function() { setStream.takeData(other); });
+  do_check_eq(other.byteLength, 2);
+}
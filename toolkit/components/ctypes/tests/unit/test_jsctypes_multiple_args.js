@@ -0,0 +1,46 @@
+/* Any copyright is dedicated to the Public Domain.
+   http://creativecommons.org/publicdomain/zero/1.0/ */
+
+// Check that every argument of a multi-argument call reaches the native
+// function, for primitive types of several sizes.
+
+Components.utils.import("resource://gre/modules/ctypes.jsm");
+
+function run_test()
+{
+  let libfile = do_get_file(ctypes.libraryName("jsctypes-test"));
+  let library = ctypes.open(libfile.path);
+
+  try {
+    let sum_int32 = library.declare("sum_int32_t_cdecl", ctypes.default_abi,
+                                    ctypes.int32_t, ctypes.int32_t, ctypes.int32_t);
+    do_check_eq(sum_int32(40, 2), 42);
+    do_check_eq(sum_int32(-7, 3), -4);
+
+    let sum_double = library.declare("sum_double_cdecl", ctypes.default_abi,
+                                     ctypes.double, ctypes.double, ctypes.double);
+    do_check_eq(sum_double(1.5, 2.25), 3.75);
+
+    let sum_alignb = library.declare("sum_alignb_int32_t_cdecl", ctypes.default_abi,
+                                     ctypes.int32_t, ctypes.char, ctypes.int32_t,
+                                     ctypes.char, ctypes.int32_t, ctypes.char);
+    do_check_eq(sum_alignb(1, 1000, 2, 20000, 3), 21000);
+
+    // More arguments than FunctionType::Call's inline array holds.
+    let int64Args = [];
+    for (let i = 0; i < 18; i++)
+      int64Args.push(ctypes.int64_t);
+    let sum_many = library.declare.apply(library,
+      ["sum_many_int64_t_cdecl", ctypes.default_abi, ctypes.int64_t].concat(int64Args));
+    let values = [];
+    let expected = 0;
+    for (let i = 1; i <= 18; i++) {
+      values.push(i * 1000);
+      expected += i * 1000;
+    }
+    do_check_eq(ctypes.Int64.compare(sum_many.apply(null, values),
+                                     ctypes.Int64(expected)), 0);
+  } finally {
+    library.close();
+  }
+}
@@ -4413,6 +4413,7 @@ class FixInvalidFrecenciesCallback : public AsyncStatementCallbackNotifier
 public:
   FixInvalidFrecenciesCallback()
     : AsyncStatementCallbackNotifier(TOPIC_FRECENCY_UPDATED)
+    , mStart(TimeStamp::Now())
   {
   }
 
@@ -4421,12 +4422,18 @@ public:
     nsresult rv = AsyncStatementCallbackNotifier::HandleCompletion(aReason);
     NS_ENSURE_SUCCESS(rv, rv);
     if (aReason == REASON_FINISHED) {
+      Telemetry::AccumulateTimeDelta(
+        Telemetry::PLACES_FIX_INVALID_FRECENCIES_TIME_MS, mStart);
+
       nsNavHistory *navHistory = nsNavHistory::GetHistoryService();
       NS_ENSURE_STATE(navHistory);
       navHistory->NotifyManyFrecenciesChanged();
     }
     return NS_OK;
   }
+
+private:
+  const TimeStamp mStart;
 };
 
 } // anonymous namespace
@@ -313,6 +313,26 @@ Classifier::ApplyUpdates(nsTArray<TableUpdate*>* aUpdates)
   }
 #endif
 
+  // Backing up copies the whole store directory, so don't start an update
+  // transaction at all when the server had nothing new for us (common case).
+  bool haveUpdates = false;
+  for (uint32_t i = 0; i < aUpdates->Length(); i++) {
+    TableUpdate *update = aUpdates->ElementAt(i);
+    if (update && !update->Empty()) {
+      haveUpdates = true;
+      break;
+    }
+  }
+
+  if (!haveUpdates) {
+    LOG(("No non-empty table updates, skipping."));
+    for (uint32_t i = 0; i < aUpdates->Length(); i++) {
+      delete aUpdates->ElementAt(i);
+    }
+    aUpdates->Clear();
+    return NS_OK;
+  }
+
   LOG(("Backup before update."));
 
   nsresult rv = BackupTables();
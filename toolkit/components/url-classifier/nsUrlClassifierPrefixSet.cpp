@@ -219,14 +219,17 @@ nsUrlClassifierPrefixSet::Contains(uint32_t aPrefix, bool* aFound)
     i--;
   }
 
-  // Now search through the deltas for the target.
+  // Now search through the deltas for the target. The deltas are sorted
+  // prefixes, so once one steps past the target it can't be in this run;
+  // stop there instead of wrapping |diff| and decoding the rest of it.
   uint32_t diff = target - mIndexPrefixes[i];
-  uint32_t deltaSize  = mIndexDeltas[i].Length();
-  uint32_t deltaIndex = 0;
+  const nsTArray<uint16_t>& deltas = mIndexDeltas[i];
+  const uint16_t* delta = deltas.Elements();
+  const uint16_t* deltaEnd = delta + deltas.Length();
 
-  while (diff > 0 && deltaIndex < deltaSize) {
-    diff -= mIndexDeltas[i][deltaIndex];
-    deltaIndex++;
+  while (diff > 0 && delta != deltaEnd && *delta <= diff) {
+    diff -= *delta;
+    delta++;
   }
 
   if (diff == 0) {
@@ -1009,11 +1009,14 @@ private:
   // buffer.
 
   uint32_t mCount;
+  // Number of entries added since the last TakeSuspectedCount() call.
+  uint32_t mSuspectedCount;
   Block mFirstBlock;
   nsPurpleBufferEntry* mFreeList;
 
 public:
   nsPurpleBuffer()
+    : mSuspectedCount(0)
   {
     InitBlocks();
   }
@@ -1127,6 +1130,7 @@ public:
     nsPurpleBufferEntry* e = NewEntry();
 
     ++mCount;
+    ++mSuspectedCount;
 
     e->mObject = aObject;
     e->mRefCnt = aRefCnt;
@@ -1153,6 +1157,13 @@ public:
     return mCount;
   }
 
+  uint32_t TakeSuspectedCount()
+  {
+    uint32_t count = mSuspectedCount;
+    mSuspectedCount = 0;
+    return count;
+  }
+
   size_t SizeOfExcludingThis(MallocSizeOf aMallocSizeOf) const
   {
     size_t n = 0;
@@ -3518,6 +3529,7 @@ nsCycleCollector::CleanupAfterCollection()
   CC_TELEMETRY(_VISITED_REF_COUNTED, mResults.mVisitedRefCounted);
   CC_TELEMETRY(_VISITED_GCED, mResults.mVisitedGCed);
   CC_TELEMETRY(_COLLECTED, mWhiteNodeCount);
+  CC_TELEMETRY(_SUSPECTED, mPurpleBuf.TakeSuspectedCount());
   timeLog.Checkpoint("CleanupAfterCollection::telemetry");
 
   if (mJSRuntime) {
@@ -3594,16 +3606,20 @@ nsCycleCollector::Collect(ccType aCCType,
         // this slice anyways.)
         continueSlice = aBudget.isUnlimited() || mResults.mNumSlices < 3;
         break;
-      case ScanAndCollectWhitePhase:
+      case ScanAndCollectWhitePhase: {
         // We do ScanRoots and CollectWhite in a single slice to ensure
         // that we won't unlink a live object if a weak reference is
         // promoted to a strong reference after ScanRoots has finished.
         // See bug 926533.
+        TimeStamp scanStart = TimeStamp::Now();
         PrintPhase("ScanRoots");
         ScanRoots(startedIdle);
         PrintPhase("CollectWhite");
         collectedAny = CollectWhite();
+        CC_TELEMETRY(_SCAN_AND_COLLECT_WHITE,
+                     uint32_t((TimeStamp::Now() - scanStart).ToMilliseconds()));
         break;
+      }
       case CleanupPhase:
         PrintPhase("CleanupAfterCollection");
         CleanupAfterCollection();
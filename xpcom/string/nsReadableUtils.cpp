@@ -438,22 +438,36 @@ AppendUnicodeTo(const nsAString::const_iterator& aSrcStart,
   copy_string(fromBegin, aSrcEnd, writer);
 }
 
-bool
-IsASCII(const nsAString& aString)
-{
-  static const char16_t NOT_ASCII = char16_t(~0x007F);
-
-
-  // Don't want to use |copy_string| for this task, since we can stop at the first non-ASCII character
-
-  nsAString::const_iterator iter, done_reading;
-  aString.BeginReading(iter);
-  aString.EndReading(done_reading);
+// Once the pointer is word-aligned, check a whole native word at a time:
+// most strings we test (URLs, header values, attribute names) are long runs
+// of ASCII.
+template<typename CharT>
+static bool
+IsASCIIImpl(const CharT* aStart, const CharT* aEnd)
+{
+  static const CharT NOT_ASCII = CharT(~0x7F);
+  // NOT_ASCII repeated across a word; truncated on 32-bit platforms.
+  static const uintptr_t NOT_ASCII_WORD =
+    uintptr_t(sizeof(CharT) == 1 ? UINT64_C(0x8080808080808080)
+                                 : UINT64_C(0xFF80FF80FF80FF80));
+  static const size_t CHARS_PER_WORD = sizeof(uintptr_t) / sizeof(CharT);
+  static const uintptr_t ALIGN_MASK = sizeof(uintptr_t) - 1;
+
+  const CharT* c = aStart;
+  while (c < aEnd && (uintptr_t(c) & ALIGN_MASK)) {
+    if (*c++ & NOT_ASCII) {
+      return false;
+    }
+  }
 
-  const char16_t* c = iter.get();
-  const char16_t* end = done_reading.get();
+  while (size_t(aEnd - c) >= CHARS_PER_WORD) {
+    if (*reinterpret_cast<const uintptr_t*>(c) & NOT_ASCII_WORD) {
+      return false;
+    }
+    c += CHARS_PER_WORD;
+  }
 
-  while (c < end) {
+  while (c < aEnd) {
     if (*c++ & NOT_ASCII) {
       return false;
     }
@@ -463,27 +477,27 @@ IsASCII(const nsAString& aString)
 }
 
 bool
-IsASCII(const nsACString& aString)
+IsASCII(const nsAString& aString)
 {
-  static const char NOT_ASCII = char(~0x7F);
+  // Don't want to use |copy_string| for this task, since we can stop at the first non-ASCII character
 
+  nsAString::const_iterator iter, done_reading;
+  aString.BeginReading(iter);
+  aString.EndReading(done_reading);
 
+  return IsASCIIImpl(iter.get(), done_reading.get());
+}
+
+bool
+IsASCII(const nsACString& aString)
+{
   // Don't want to use |copy_string| for this task, since we can stop at the first non-ASCII character
 
   nsACString::const_iterator iter, done_reading;
   aString.BeginReading(iter);
   aString.EndReading(done_reading);
 
-  const char* c = iter.get();
-  const char* end = done_reading.get();
-
-  while (c < end) {
-    if (*c++ & NOT_ASCII) {
-      return false;
-    }
-  }
-
-  return true;
+  return IsASCIIImpl(iter.get(), done_reading.get());
 }
 
 bool
@@ -69,10 +69,19 @@ nsEventQueue::GetEvent(bool aMayWait, nsIRunnable** aResult)
     }
 
     if (aResult) {
-      *aResult = mHead->mEvents[mOffsetHead++];
-
-      // Check if mHead points to empty Page
-      if (mOffsetHead == EVENTS_PER_PAGE) {
+      *aResult = mHead->mEvents[mOffsetHead];
+      mHead->mEvents[mOffsetHead] = nullptr;
+      ++mOffsetHead;
+
+      if (mHead == mTail && mOffsetHead == mOffsetTail) {
+        // The queue is now empty.  Start over at the beginning of the current
+        // page, so that a queue which keeps draining never has to allocate
+        // another page.  The slots we consumed have been cleared, which
+        // PutEvent relies on.
+        mOffsetHead = 0;
+        mOffsetTail = 0;
+      } else if (mOffsetHead == EVENTS_PER_PAGE) {
+        // mHead points to an empty Page
         Page* dead = mHead;
         mHead = mHead->mNext;
         FreePage(dead);
@@ -119,5 +128,9 @@ nsEventQueue::PutEvent(nsIRunnable* aRunnable)
   event.swap(mTail->mEvents[mOffsetTail]);
   ++mOffsetTail;
   LOG(("EVENTQ(%p): notify\n", this));
-  mon.NotifyAll();
+  // Everyone waiting on this monitor is waiting for an event and checks the
+  // queue as soon as it wakes up, so waking a single waiter is enough.  For
+  // thread pools this keeps every idle thread from waking up and contending
+  // for the monitor on each dispatch.
+  mon.Notify();
 }